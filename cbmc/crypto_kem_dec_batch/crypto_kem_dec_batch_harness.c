@@ -0,0 +1,31 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <stdlib.h>
+#include <kem.h>
+
+/*
+ * crypto_kem_dec_batch() has no assigns clause for its n outputs, so
+ * instead of checking a contract, we bound n and call it directly.
+ * MAX_BATCH covers full groups as well as every size of a partial
+ * last group, including the single leftover entry.
+ */
+#define MAX_BATCH 9
+
+void harness(void)
+{
+  size_t n, l;
+  uint8_t *ss[MAX_BATCH];
+  const uint8_t *ct[MAX_BATCH], *sk[MAX_BATCH];
+
+  assume(n <= MAX_BATCH);
+  for (l = 0; l < n; l++)
+  {
+    ss[l] = malloc(MLKEM_SSBYTES);
+    ct[l] = malloc(MLKEM_CIPHERTEXTBYTES);
+    sk[l] = malloc(MLKEM_SECRETKEYBYTES);
+    assume(ss[l] != NULL && ct[l] != NULL && sk[l] != NULL);
+  }
+
+  crypto_kem_dec_batch(n, ss, ct, sk);
+}
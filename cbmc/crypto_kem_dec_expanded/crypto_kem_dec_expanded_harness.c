@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT-0
+
+#include <kem.h>
+
+void harness(void)
+{
+  uint8_t *a, *b;
+  mlkem_expanded_sk *c;
+  crypto_kem_dec_expanded(a, b, c);
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <kem.h>
+
+void harness(void)
+{
+  uint8_t *a, *b, *c;
+  mlkem_pk_cache *d;
+  crypto_kem_enc_cached(a, b, c, d);
+}
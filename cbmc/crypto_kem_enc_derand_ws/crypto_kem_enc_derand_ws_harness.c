@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT-0
+
+#include <kem.h>
+
+void harness(void)
+{
+  uint8_t *a, *b, *c, *d;
+  mlkem_workspace *ws;
+  crypto_kem_enc_derand_ws(a, b, c, d, ws);
+}
@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <kem.h>
+
+void harness(void)
+{
+  uint8_t *ct[4], *ss[4];
+  const uint8_t *pk[4];
+
+  crypto_kem_enc_x4(ct, ss, pk);
+}
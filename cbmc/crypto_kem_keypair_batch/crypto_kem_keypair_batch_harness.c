@@ -0,0 +1,31 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <stdlib.h>
+#include <kem.h>
+
+/*
+ * crypto_kem_keypair_batch() has no assigns clause for its n outputs,
+ * so instead of checking a contract, we bound n and call it directly.
+ * MAX_BATCH covers full groups as well as every size of a partial
+ * last group, including the single leftover entry.
+ */
+#define MAX_BATCH 9
+
+void harness(void)
+{
+  size_t n, l;
+  uint8_t *pk[MAX_BATCH], *sk[MAX_BATCH];
+  const uint8_t *coins[MAX_BATCH];
+
+  assume(n <= MAX_BATCH);
+  for (l = 0; l < n; l++)
+  {
+    pk[l] = malloc(MLKEM_PUBLICKEYBYTES);
+    sk[l] = malloc(MLKEM_SECRETKEYBYTES);
+    coins[l] = malloc(2 * MLKEM_SYMBYTES);
+    assume(pk[l] != NULL && sk[l] != NULL && coins[l] != NULL);
+  }
+
+  crypto_kem_keypair_batch(n, pk, sk, coins);
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+
+void harness(void)
+{
+  uint8_t *m, *c, *sk;
+  indcpa_dec_workspace *ws;
+  indcpa_dec_ws(m, c, sk, ws);
+}
@@ -0,0 +1,13 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+#include <poly.h>
+
+void harness(void)
+{
+  uint8_t *a, *b, *d;
+  indcpa_expanded_pk *c;
+  indcpa_enc_expanded(a, b, c, d);
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+
+void harness(void)
+{
+  uint8_t *a, *b, *c, *d;
+  indcpa_enc_workspace *ws;
+  indcpa_enc_ws(a, b, c, d, ws);
+}
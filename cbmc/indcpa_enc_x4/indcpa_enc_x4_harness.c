@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+
+void harness(void)
+{
+  uint8_t *c[4];
+  const uint8_t *m[4], *pk[4], *coins[4];
+
+  indcpa_enc_x4(c, m, pk, coins);
+}
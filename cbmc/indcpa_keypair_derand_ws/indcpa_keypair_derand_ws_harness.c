@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+
+void harness(void)
+{
+  uint8_t *a, *b, *c;
+  indcpa_keypair_workspace *ws;
+  indcpa_keypair_derand_ws(a, b, c, ws);
+}
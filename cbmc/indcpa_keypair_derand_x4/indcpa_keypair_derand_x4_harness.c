@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <indcpa.h>
+
+void harness(void)
+{
+  uint8_t *pk[4], *sk[4];
+  const uint8_t *coins[4];
+
+  indcpa_keypair_derand_x4(pk, sk, coins);
+}
@@ -0,0 +1,19 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// declare here since it's static in non-CBMC builds
+void keccak_inc_squeeze(uint8_t *h, size_t outlen, shake256incctx *c,
+                        uint32_t r);
+
+void harness(void)
+{
+  uint8_t *h;
+  size_t outlen;
+  shake256incctx *c;
+  uint32_t r;
+  keccak_inc_squeeze(h, outlen, c, r);
+}
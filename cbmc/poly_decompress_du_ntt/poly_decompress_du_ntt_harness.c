@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0 AND Apache-2.0
+
+#include "poly.h"
+
+void harness(void)
+{
+  poly *r;
+  uint8_t *a;
+
+  poly_decompress_du_ntt(r, a);
+}
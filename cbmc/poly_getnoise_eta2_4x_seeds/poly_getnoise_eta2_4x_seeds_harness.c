@@ -0,0 +1,13 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <poly.h>
+
+void harness(void)
+{
+  poly *r;
+  const uint8_t *seed[4];
+  uint8_t nonce;
+
+  poly_getnoise_eta2_4x_seeds(r, seed, nonce);
+}
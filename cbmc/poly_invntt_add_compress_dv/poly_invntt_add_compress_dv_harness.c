@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0 AND Apache-2.0
+
+#include "poly.h"
+
+void harness(void)
+{
+  poly *a, *e, *m;
+  uint8_t *r;
+
+  poly_invntt_add_compress_dv(r, a, e, m);
+}
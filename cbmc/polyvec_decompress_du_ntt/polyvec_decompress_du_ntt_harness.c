@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0 AND Apache-2.0
+
+#include "polyvec.h"
+
+void harness(void)
+{
+  polyvec *r;
+  uint8_t *a;
+
+  polyvec_decompress_du_ntt(r, a);
+}
@@ -0,0 +1,13 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0 AND Apache-2.0
+
+#include "poly.h"
+#include "polyvec.h"
+
+void harness(void)
+{
+  polyvec *b, *e;
+  uint8_t *r;
+
+  polyvec_invntt_add_compress_du(r, b, e);
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <polyvec.h>
+
+void harness(void)
+{
+  uint8_t *a;
+  int r;
+  r = polyvec_modulus_check(a);
+}
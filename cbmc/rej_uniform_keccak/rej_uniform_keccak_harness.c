@@ -0,0 +1,12 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include "rej_uniform.h"
+
+void harness(void)
+{
+  int16_t *r;
+  unsigned int target, offset;
+  uint64_t *state;
+  rej_uniform_keccak(r, target, offset, state);
+}
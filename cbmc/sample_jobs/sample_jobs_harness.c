@@ -0,0 +1,11 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include "sampling.h"
+
+void harness(void)
+{
+  sample_job *jobs;
+  unsigned int njobs;
+  sample_jobs(jobs, njobs);
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  sha3_512incctx *state;
+  const uint8_t *input;
+  size_t inlen;
+  sha3_512_inc_absorb(state, input, inlen);
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202x4.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  uint8_t *out0, *out1, *out2, *out3;
+  const uint8_t *in0, *in1, *in2, *in3;
+  size_t inlen;
+  sha3_512x4(out0, out1, out2, out3, in0, in1, in2, in3, inlen);
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  shake256incctx *state;
+  const uint8_t *input;
+  size_t inlen;
+  shake256_inc_absorb(state, input, inlen);
+}
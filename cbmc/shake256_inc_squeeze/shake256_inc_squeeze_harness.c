@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  uint8_t *output;
+  size_t outlen;
+  shake256incctx *state;
+  shake256_inc_squeeze(output, outlen, state);
+}
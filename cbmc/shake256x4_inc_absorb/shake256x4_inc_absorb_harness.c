@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202x4.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  shake256x4incctx *state;
+  const uint8_t *in0, *in1, *in2, *in3;
+  size_t inlen;
+  shake256x4_inc_absorb(state, in0, in1, in2, in3, inlen);
+}
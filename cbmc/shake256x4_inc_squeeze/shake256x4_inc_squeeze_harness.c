@@ -0,0 +1,14 @@
+// Copyright (c) 2024 The mlkem-native project authors
+// SPDX-License-Identifier: MIT-0
+
+#include <fips202x4.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void harness(void)
+{
+  uint8_t *out0, *out1, *out2, *out3;
+  size_t outlen;
+  shake256x4incctx *state;
+  shake256x4_inc_squeeze(out0, out1, out2, out3, outlen, state);
+}
@@ -3,8 +3,9 @@
 # Automatically detect system architecture and set preprocessor etc accordingly
 ifeq ($(HOST_PLATFORM),Linux-x86_64)
 ifeq ($(CROSS_PREFIX),)
-	CFLAGS += -mavx2 -mbmi2 -mpopcnt -maes
+	CFLAGS_AVX2 := -mavx2 -mbmi -mbmi2 -mpopcnt -maes
 	CFLAGS += -DFORCE_X86_64
+	CFLAGS_AVX512 := -mavx512f -mavx512bw -mavx512vbmi -mavx512vbmi2
 else ifneq ($(findstring aarch64_be, $(CROSS_PREFIX)),)
 	CFLAGS += -DFORCE_AARCH64_EB
 else ifneq ($(findstring aarch64, $(CROSS_PREFIX)),)
@@ -18,8 +19,9 @@ else ifeq ($(HOST_PLATFORM),Linux-aarch64)
 ifeq ($(CROSS_PREFIX),)
 	CFLAGS += -DFORCE_AARCH64
 else ifneq ($(findstring x86_64, $(CROSS_PREFIX)),)
-	CFLAGS += -mavx2 -mbmi2 -mpopcnt -maes
+	CFLAGS_AVX2 := -mavx2 -mbmi -mbmi2 -mpopcnt -maes
 	CFLAGS += -DFORCE_X86_64
+	CFLAGS_AVX512 := -mavx512f -mavx512bw -mavx512vbmi -mavx512vbmi2
 else
 endif
 
@@ -27,3 +29,14 @@ endif
 else ifeq ($(HOST_PLATFORM),Darwin-arm64)
 	CFLAGS += -DFORCE_AARCH64
 endif
+
+# With DISPATCH=1, only the x86_64 backends are compiled with AVX2
+# enabled, see mk/dispatch.mk.
+ifneq ($(DISPATCH),1)
+CFLAGS += $(CFLAGS_AVX2)
+endif
+
+# Only the sources of the AVX-512 arithmetic backend are compiled with
+# AVX-512 enabled: with AVX512BW, GCC moves 64-bit scalar logic (such as
+# the Keccak permutation) into mask registers, which is considerably slower.
+%_avx512.c.o: CFLAGS += $(CFLAGS_AVX512)
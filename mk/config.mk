@@ -77,7 +77,9 @@ endif
 AUTO ?= 1
 CYCLES ?=
 OPT ?= 1
-RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO
+DISPATCH ?= 0
+LOWMEM ?= 0
+RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO DISPATCH LOWMEM
 
 ifeq ($(AUTO),1)
 include mk/auto.mk
@@ -92,6 +94,10 @@ CONFIG := $(BUILD_DIR)/config.mk
 
 -include $(CONFIG)
 
+ifeq ($(LOWMEM),1)
+	CFLAGS += -DMLKEM_NATIVE_LOW_MEMORY
+endif
+
 $(CONFIG):
 	@echo "  GEN     $@"
 	$(Q)[ -d $(@D) ] || mkdir -p $(@D)
@@ -5,7 +5,13 @@ ifeq ($(OPT),1)
 	FIPS202_SRCS += $(wildcard mlkem/fips202/native/aarch64/src/*.S) $(wildcard mlkem/fips202/native/aarch64/src/*.c) $(wildcard mlkem/fips202/native/x86_64/src/*.c)
 endif
 
-$(BUILD_DIR)/libmlkem.a: $(call OBJS, $(FIPS202_SRCS))
-$(BUILD_DIR)/libmlkem512.a: $(call OBJS, $(FIPS202_SRCS))
-$(BUILD_DIR)/libmlkem768.a: $(call OBJS, $(FIPS202_SRCS))
-$(BUILD_DIR)/libmlkem1024.a: $(call OBJS, $(FIPS202_SRCS))
+ifeq ($(DISPATCH),1)
+FIPS202_OBJS = $(call DISPATCH_OBJS,,$(FIPS202_SRCS))
+else
+FIPS202_OBJS = $(call OBJS, $(FIPS202_SRCS))
+endif
+
+$(BUILD_DIR)/libmlkem.a: $(FIPS202_OBJS)
+$(BUILD_DIR)/libmlkem512.a: $(FIPS202_OBJS)
+$(BUILD_DIR)/libmlkem768.a: $(FIPS202_OBJS)
+$(BUILD_DIR)/libmlkem1024.a: $(FIPS202_OBJS)
@@ -0,0 +1,53 @@
+# SPDX-License-Identifier: Apache-2.0
+#
+# Runtime backend dispatch (DISPATCH=1)
+#
+# The library is compiled once per backend ("variant") below, each under
+# its own namespace, plus mlkem/dispatch.c, which provides the public API
+# and forwards to the best variant for the host CPU.
+#
+# Variant objects live in $(BUILD_DIR)/dispatch/<variant>/.
+
+ifeq ($(DISPATCH),1)
+
+ifeq ($(CFLAGS_AVX512),)
+$(error DISPATCH=1 is only supported for x86_64 targets with AUTO=1)
+endif
+ifneq ($(OPT),1)
+$(error DISPATCH=1 requires OPT=1)
+endif
+
+CFLAGS += -DMLKEM_NATIVE_DISPATCH
+
+DISPATCH_VARIANTS := c avx2 avx512
+
+DISPATCH_CFLAGS_c :=
+DISPATCH_CFLAGS_avx2 := -DMLKEM_USE_NATIVE $(CFLAGS_AVX2)
+DISPATCH_CFLAGS_avx512 := -DMLKEM_USE_NATIVE $(CFLAGS_AVX2) \
+	-DMLKEM_NATIVE_ARITH_BACKEND=\"native/x86_64/avx512.h\" \
+	-DMLKEM_NATIVE_FIPS202_BACKEND=\"fips202/native/x86_64/avx512.h\"
+
+# Objects of all variants for the given sources; $(1) is the subdirectory
+# (empty for FIPS202, the scheme for everything else), $(2) the sources.
+DISPATCH_OBJS = $(foreach v,$(DISPATCH_VARIANTS),$(call MAKE_OBJS,$(BUILD_DIR)/dispatch/$(v)$(1),$(2)))
+
+# Compilation rules for objects in directory $(1)
+define DISPATCH_COMPILE_RULES
+$(1)/%.c.o: %.c $(CONFIG)
+	$(Q)echo "  CC      $$@"
+	$(Q)[ -d $$(@D) ] || mkdir -p $$(@D)
+	$(Q)$$(CC) -c -o $$@ $$(CFLAGS) $$<
+
+$(1)/%.S.o: %.S $(CONFIG)
+	$(Q)echo "  AS      $$@"
+	$(Q)[ -d $$(@D) ] || mkdir -p $$(@D)
+	$(Q)$$(CC) -c -o $$@ $$(CFLAGS) $$<
+endef
+
+$(foreach v,$(DISPATCH_VARIANTS), \
+	$(eval $(BUILD_DIR)/dispatch/$(v)/%: CFLAGS += -UMLKEM_NATIVE_DISPATCH $(DISPATCH_CFLAGS_$(v))) \
+	$(eval $(call DISPATCH_COMPILE_RULES,$(BUILD_DIR)/dispatch/$(v))) \
+	$(foreach scheme,mlkem512 mlkem768 mlkem1024, \
+		$(eval $(call DISPATCH_COMPILE_RULES,$(BUILD_DIR)/dispatch/$(v)/$(scheme)))))
+
+endif
@@ -1,9 +1,12 @@
 # SPDX-License-Identifier: Apache-2.0
 SOURCES += $(wildcard mlkem/*.c) $(wildcard mlkem/debug/*.c)
 ifeq ($(OPT),1)
-	SOURCES += $(wildcard mlkem/native/aarch64/src/*.[csS]) $(wildcard mlkem/native/x86_64/src/*.[csS])
+	SOURCES += $(wildcard mlkem/native/aarch64/src/*.[csS]) $(wildcard mlkem/native/x86_64/src/*.[csS]) \
+		$(wildcard mlkem/native/portable_simd/src/*.c)
+ifneq ($(DISPATCH),1)
 	CFLAGS += -DMLKEM_USE_NATIVE
 endif
+endif
 
 CFLAGS += -Imlkem -Imlkem/sys -Imlkem/native -Imlkem/native/aarch64 -Imlkem/native/x86_64
 ALL_TESTS = test_mlkem acvp_mlkem bench_mlkem bench_components_mlkem gen_NISTKAT gen_KAT
@@ -13,16 +16,23 @@ MLKEM512_DIR = $(BUILD_DIR)/mlkem512
 MLKEM768_DIR = $(BUILD_DIR)/mlkem768
 MLKEM1024_DIR = $(BUILD_DIR)/mlkem1024
 
+# objects of lib<scheme>.a, excluding FIPS202
+ifeq ($(DISPATCH),1)
+LIB_OBJS = $(call MAKE_OBJS,$(BUILD_DIR)/$(1),mlkem/dispatch.c) $(call DISPATCH_OBJS,/$(1),$(SOURCES))
+else
+LIB_OBJS = $(call MAKE_OBJS,$(BUILD_DIR)/$(1),$(SOURCES))
+endif
+
 # build lib<scheme>.a
 define BUILD_LIB
 $(BUILD_DIR)/lib$(1).a: CFLAGS += -static
-$(BUILD_DIR)/lib$(1).a: $(call MAKE_OBJS,$(BUILD_DIR)/$(1),$(SOURCES))
+$(BUILD_DIR)/lib$(1).a: $(call LIB_OBJS,$(1))
 
 # NOTE:
 # libmlkem.a does not link against libmlkem{512,768,1024}.a, but the underlying object files.
 # Still, we currently need a dependency on libmlkem{512,768,1024}.a here as otherwise there is
 # a hiccup with the setting of MLKEM_K (TODO: look at this more closely)
-$(BUILD_DIR)/libmlkem.a: $(BUILD_DIR)/lib$(1).a $(call MAKE_OBJS,$(BUILD_DIR)/$(1),$(SOURCES))
+$(BUILD_DIR)/libmlkem.a: $(BUILD_DIR)/lib$(1).a $(call LIB_OBJS,$(1))
 endef
 
 $(BUILD_DIR)/libmlkem512.a: CFLAGS += -DMLKEM_K=2
@@ -4,6 +4,11 @@
  */
 #include "cbd.h"
 #include <stdint.h>
+#include "arith_backend.h"
+#include "debug/debug.h"
+
+#if (MLKEM_ETA1 == 2 && !defined(MLKEM_USE_NATIVE_POLY_CBD_ETA1)) || \
+    !defined(MLKEM_USE_NATIVE_POLY_CBD_ETA2)
 
 /*************************************************
  * Name:        load32_littleendian
@@ -25,28 +30,6 @@ static uint32_t load32_littleendian(const uint8_t x[4])
   return r;
 }
 
-/*************************************************
- * Name:        load24_littleendian
- *
- * Description: load 3 bytes into a 32-bit integer
- *              in little-endian order.
- *              This function is only needed for ML-KEM-512
- *
- * Arguments:   - const uint8_t *x: pointer to input byte array
- *
- * Returns 32-bit unsigned integer loaded from x (most significant byte is zero)
- **************************************************/
-#if MLKEM_ETA1 == 3
-static uint32_t load24_littleendian(const uint8_t x[3])
-{
-  uint32_t r;
-  r = (uint32_t)x[0];
-  r |= (uint32_t)x[1] << 8;
-  r |= (uint32_t)x[2] << 16;
-  return r;
-}
-#endif
-
 /*************************************************
  * Name:        cbd2
  *
@@ -81,6 +64,29 @@ static void cbd2(poly *r, const uint8_t buf[2 * MLKEM_N / 4])
     }
   }
 }
+#endif /* (MLKEM_ETA1 == 2 && !MLKEM_USE_NATIVE_POLY_CBD_ETA1) || \
+          !MLKEM_USE_NATIVE_POLY_CBD_ETA2 */
+
+#if MLKEM_ETA1 == 3 && !defined(MLKEM_USE_NATIVE_POLY_CBD_ETA1)
+/*************************************************
+ * Name:        load24_littleendian
+ *
+ * Description: load 3 bytes into a 32-bit integer
+ *              in little-endian order.
+ *              This function is only needed for ML-KEM-512
+ *
+ * Arguments:   - const uint8_t *x: pointer to input byte array
+ *
+ * Returns 32-bit unsigned integer loaded from x (most significant byte is zero)
+ **************************************************/
+static uint32_t load24_littleendian(const uint8_t x[3])
+{
+  uint32_t r;
+  r = (uint32_t)x[0];
+  r |= (uint32_t)x[1] << 8;
+  r |= (uint32_t)x[2] << 16;
+  return r;
+}
 
 /*************************************************
  * Name:        cbd3
@@ -93,7 +99,6 @@ static void cbd2(poly *r, const uint8_t buf[2 * MLKEM_N / 4])
  * Arguments:   - poly *r: pointer to output polynomial
  *              - const uint8_t *buf: pointer to input byte array
  **************************************************/
-#if MLKEM_ETA1 == 3
 static void cbd3(poly *r, const uint8_t buf[3 * MLKEM_N / 4])
 {
   int i;
@@ -121,6 +126,7 @@ static void cbd3(poly *r, const uint8_t buf[3 * MLKEM_N / 4])
 }
 #endif
 
+#if !defined(MLKEM_USE_NATIVE_POLY_CBD_ETA1)
 void poly_cbd_eta1(poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4])
 {
 #if MLKEM_ETA1 == 2
@@ -131,7 +137,15 @@ void poly_cbd_eta1(poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4])
 #error "This implementation requires eta1 in {2,3}"
 #endif
 }
+#else  /* MLKEM_USE_NATIVE_POLY_CBD_ETA1 */
+void poly_cbd_eta1(poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4])
+{
+  poly_cbd_eta1_native(r, buf);
+  POLY_BOUND_MSG(r, MLKEM_ETA1 + 1, "poly_cbd_eta1 output");
+}
+#endif /* MLKEM_USE_NATIVE_POLY_CBD_ETA1 */
 
+#if !defined(MLKEM_USE_NATIVE_POLY_CBD_ETA2)
 void poly_cbd_eta2(poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4])
 {
 #if MLKEM_ETA2 == 2
@@ -140,3 +154,10 @@ void poly_cbd_eta2(poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4])
 #error "This implementation requires eta2 = 2"
 #endif
 }
+#else  /* MLKEM_USE_NATIVE_POLY_CBD_ETA2 */
+void poly_cbd_eta2(poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4])
+{
+  poly_cbd_eta2_native(r, buf);
+  POLY_BOUND_MSG(r, MLKEM_ETA2 + 1, "poly_cbd_eta2 output");
+}
+#endif /* MLKEM_USE_NATIVE_POLY_CBD_ETA2 */
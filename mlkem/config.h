@@ -95,4 +95,25 @@
 #define MLKEM_NATIVE_FIPS202_BACKEND "fips202/native/default.h"
 #endif /* MLKEM_NATIVE_FIPS202_BACKEND */
 
+/******************************************************************************
+ * Name:        MLKEM_NATIVE_LOW_MEMORY
+ *
+ * Description: If defined, key generation, encapsulation and decapsulation
+ *              never hold the whole matrix A in memory: it is generated
+ *              one row at a time, and each row is accumulated into the
+ *              matrix-vector product right away. This reduces stack usage
+ *              by about (MLKEM_K - 1) * MLKEM_K * 512 bytes, at the cost of
+ *              some throughput, as matrix and noise sampling no longer
+ *              share Keccak permutations.
+ *
+ *              The expanded-key API is unaffected, as expanded keys
+ *              contain the matrix by design.
+ *
+ *              This can also be set using CFLAGS, or via `make LOWMEM=1`.
+ *
+ *****************************************************************************/
+#if !defined(MLKEM_NATIVE_LOW_MEMORY)
+/* #define MLKEM_NATIVE_LOW_MEMORY */
+#endif
+
 #endif /* MLkEM_NATIVE_CONFIG_H */
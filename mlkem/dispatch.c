@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "dispatch.h"
+
+#if defined(MLKEM_NATIVE_DISPATCH)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(MLKEM_USE_NATIVE)
+#error MLKEM_NATIVE_DISPATCH selects backends at runtime and must not be combined with MLKEM_USE_NATIVE
+#endif
+
+#if !defined(SYS_X86_64)
+#error MLKEM_NATIVE_DISPATCH is currently only supported on x86_64
+#endif
+
+#include <cpuid.h>
+
+/* Name of a public API function in the namespace of the given backend */
+#define DISPATCH_NAMESPACE(backend, s) \
+  __MLKEM_DEFAULT_NAMESPACE(PQCP_MLKEM_NATIVE, MLKEM_PARAM_NAME, backend, s)
+
+#define DISPATCH_DECLARE(name, params, args) \
+  int DISPATCH_NAMESPACE(DISPATCH_BACKEND, name) params;
+#define DISPATCH_ENTRY(name, params, args) \
+  DISPATCH_NAMESPACE(DISPATCH_BACKEND, name),
+
+/*
+ * Backends compiled into a dispatch build; see mk/dispatch.mk.
+ * The names must match MLKEM_NATIVE_ARITH_BACKEND_NAME of the respective
+ * arithmetic backend.
+ */
+
+/* C backend, no requirements beyond x86_64 */
+#define DISPATCH_BACKEND C
+MLKEM_DISPATCH_API(DISPATCH_DECLARE)
+static const mlkem_backend backend_c = {
+    "C", MLKEM_DISPATCH_API(DISPATCH_ENTRY)};
+#undef DISPATCH_BACKEND
+
+/* Default x86_64 backend; compiled with -mavx2 -mbmi -mbmi2 -mpopcnt -maes */
+#define DISPATCH_BACKEND X86_64_DEFAULT
+MLKEM_DISPATCH_API(DISPATCH_DECLARE)
+static const mlkem_backend backend_x86_64_default = {
+    "X86_64_DEFAULT", MLKEM_DISPATCH_API(DISPATCH_ENTRY)};
+#undef DISPATCH_BACKEND
+
+/* AVX-512 x86_64 backend; additionally uses AVX512F/BW/VBMI/VBMI2 */
+#define DISPATCH_BACKEND X86_64_AVX512
+MLKEM_DISPATCH_API(DISPATCH_DECLARE)
+static const mlkem_backend backend_x86_64_avx512 = {
+    "X86_64_AVX512", MLKEM_DISPATCH_API(DISPATCH_ENTRY)};
+#undef DISPATCH_BACKEND
+
+/* CPUID.1:ECX */
+#define CPUID1_ECX_POPCNT (1u << 23)
+#define CPUID1_ECX_AES (1u << 25)
+#define CPUID1_ECX_OSXSAVE (1u << 27)
+#define CPUID1_ECX_AVX (1u << 28)
+/* CPUID.(EAX=7,ECX=0):EBX */
+#define CPUID7_EBX_BMI1 (1u << 3)
+#define CPUID7_EBX_AVX2 (1u << 5)
+#define CPUID7_EBX_BMI2 (1u << 8)
+#define CPUID7_EBX_AVX512F (1u << 16)
+#define CPUID7_EBX_AVX512BW (1u << 30)
+/* CPUID.(EAX=7,ECX=0):ECX */
+#define CPUID7_ECX_AVX512VBMI (1u << 1)
+#define CPUID7_ECX_AVX512VBMI2 (1u << 6)
+/* XCR0: SSE and AVX state; opmask and upper ZMM state */
+#define XCR0_YMM 0x06u
+#define XCR0_ZMM 0xE6u
+
+static uint32_t xgetbv0(void)
+{
+  uint32_t lo, hi;
+  /* xgetbv, spelled out for assemblers without XSAVE support */
+  __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(lo), "=d"(hi) : "c"(0));
+  (void)hi;
+  return lo;
+}
+
+static int has_all(uint32_t reg, uint32_t mask) { return (reg & mask) == mask; }
+
+const mlkem_backend *mlkem_backend_select(void)
+{
+  unsigned int eax, ebx, ecx1, ecx7, edx;
+  uint32_t xcr0;
+
+  if (!__get_cpuid(1, &eax, &ebx, &ecx1, &edx))
+  {
+    return &backend_c;
+  }
+
+  /* The OS must save and restore the YMM/ZMM state for us to use it */
+  if (!has_all(ecx1, CPUID1_ECX_OSXSAVE | CPUID1_ECX_AVX))
+  {
+    return &backend_c;
+  }
+  xcr0 = xgetbv0();
+
+  if (__get_cpuid_max(0, NULL) < 7)
+  {
+    return &backend_c;
+  }
+  __cpuid_count(7, 0, eax, ebx, ecx7, edx);
+
+  if (!has_all(xcr0, XCR0_YMM) ||
+      !has_all(ecx1, CPUID1_ECX_POPCNT | CPUID1_ECX_AES) ||
+      !has_all(ebx, CPUID7_EBX_AVX2 | CPUID7_EBX_BMI1 | CPUID7_EBX_BMI2))
+  {
+    return &backend_c;
+  }
+
+  if (!has_all(xcr0, XCR0_ZMM) ||
+      !has_all(ebx, CPUID7_EBX_AVX512F | CPUID7_EBX_AVX512BW) ||
+      !has_all(ecx7, CPUID7_ECX_AVX512VBMI | CPUID7_ECX_AVX512VBMI2))
+  {
+    return &backend_x86_64_default;
+  }
+
+  return &backend_x86_64_avx512;
+}
+
+/*
+ * Backend selected on first use. Accessed atomically, via the GCC/clang
+ * builtins rather than C11 <stdatomic.h> since the code base is C99; any
+ * compiler providing <cpuid.h> provides those. Concurrent first calls may
+ * each run the selection, which is harmless as they store the same value.
+ */
+static const mlkem_backend *backend_current = NULL;
+
+const mlkem_backend *mlkem_backend_get(void)
+{
+  const mlkem_backend *b = __atomic_load_n(&backend_current, __ATOMIC_ACQUIRE);
+  if (b == NULL)
+  {
+    b = mlkem_backend_select();
+    __atomic_store_n(&backend_current, b, __ATOMIC_RELEASE);
+  }
+  return b;
+}
+
+/* Public API: forward to the selected backend */
+#define DISPATCH_FORWARD(name, params, args) \
+  int MLKEM_NAMESPACE(name) params { return mlkem_backend_get()->name args; }
+MLKEM_DISPATCH_API(DISPATCH_FORWARD)
+
+#else /* MLKEM_NATIVE_DISPATCH */
+
+#define empty_cu_dispatch MLKEM_NAMESPACE(empty_cu_dispatch)
+int empty_cu_dispatch;
+
+#endif /* MLKEM_NATIVE_DISPATCH */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include "kem.h"
+
+/*
+ * Runtime backend dispatch
+ *
+ * If MLKEM_NATIVE_DISPATCH is set, mlkem-native is built several times with
+ * different backends, each under its own namespace, and the public API in
+ * kem.h is provided by dispatch.c: it forwards every call to the fastest
+ * backend supported by the host CPU, which is determined via CPUID on
+ * first use.
+ *
+ * Structures passed through the public API must be large enough for
+ * every backend: mlkem_workspace is sized for the 8-fold sampling state
+ * of the AVX-512 backend, see sample_workspace in sampling.h.
+ */
+#if defined(MLKEM_NATIVE_DISPATCH)
+
+/*
+ * List of all functions of the public API, in the form
+ *   X(name, (parameters), (arguments))
+ * where name is the name of the function without the crypto_kem_ prefix.
+ */
+#define MLKEM_DISPATCH_API(X)                                                  \
+  X(keypair_derand, (uint8_t * pk, uint8_t * sk, const uint8_t * coins),       \
+    (pk, sk, coins))                                                           \
+  X(keypair, (uint8_t * pk, uint8_t * sk), (pk, sk))                           \
+  X(keypair_derand_ws,                                                         \
+    (uint8_t * pk, uint8_t * sk, const uint8_t * coins, mlkem_workspace * ws), \
+    (pk, sk, coins, ws))                                                       \
+  X(keypair_ws, (uint8_t * pk, uint8_t * sk, mlkem_workspace * ws),            \
+    (pk, sk, ws))                                                              \
+  X(keypair_batch,                                                             \
+    (size_t n, uint8_t * pk[], uint8_t * sk[], const uint8_t * coins[]),       \
+    (n, pk, sk, coins))                                                        \
+  X(enc_derand,                                                                \
+    (uint8_t * ct, uint8_t * ss, const uint8_t * pk, const uint8_t * coins),   \
+    (ct, ss, pk, coins))                                                       \
+  X(enc, (uint8_t * ct, uint8_t * ss, const uint8_t * pk), (ct, ss, pk))       \
+  X(enc_derand_ws,                                                             \
+    (uint8_t * ct, uint8_t * ss, const uint8_t * pk, const uint8_t * coins,    \
+     mlkem_workspace * ws),                                                    \
+    (ct, ss, pk, coins, ws))                                                   \
+  X(enc_ws,                                                                    \
+    (uint8_t * ct, uint8_t * ss, const uint8_t * pk, mlkem_workspace * ws),    \
+    (ct, ss, pk, ws))                                                          \
+  X(pk_expand, (mlkem_expanded_pk * epk, const uint8_t * pk), (epk, pk))       \
+  X(enc_expanded_derand,                                                       \
+    (uint8_t * ct, uint8_t * ss, const mlkem_expanded_pk * epk,                \
+     const uint8_t * coins),                                                   \
+    (ct, ss, epk, coins))                                                      \
+  X(enc_expanded, (uint8_t * ct, uint8_t * ss, const mlkem_expanded_pk * epk), \
+    (ct, ss, epk))                                                             \
+  X(pk_cache_init,                                                             \
+    (mlkem_pk_cache * cache, mlkem_pk_cache_entry * entries, size_t capacity,  \
+     mlkem_pk_cache_lock_fn lock, mlkem_pk_cache_lock_fn unlock,               \
+     void * lock_arg),                                                         \
+    (cache, entries, capacity, lock, unlock, lock_arg))                        \
+  X(pk_cache_stats,                                                            \
+    (mlkem_pk_cache * cache, uint64_t * hits, uint64_t * misses),              \
+    (cache, hits, misses))                                                     \
+  X(enc_cached_derand,                                                         \
+    (uint8_t * ct, uint8_t * ss, const uint8_t * pk, mlkem_pk_cache * cache,   \
+     const uint8_t * coins),                                                   \
+    (ct, ss, pk, cache, coins))                                                \
+  X(enc_cached,                                                                \
+    (uint8_t * ct, uint8_t * ss, const uint8_t * pk, mlkem_pk_cache * cache),  \
+    (ct, ss, pk, cache))                                                       \
+  X(enc_x4_derand,                                                             \
+    (uint8_t * ct[4], uint8_t * ss[4], const uint8_t * pk[4],                  \
+     const uint8_t * coins[4]),                                                \
+    (ct, ss, pk, coins))                                                       \
+  X(enc_x4, (uint8_t * ct[4], uint8_t * ss[4], const uint8_t * pk[4]),         \
+    (ct, ss, pk))                                                              \
+  X(sk_expand, (mlkem_expanded_sk * esk, const uint8_t * sk), (esk, sk))       \
+  X(dec_expanded,                                                              \
+    (uint8_t * ss, const uint8_t * ct, const mlkem_expanded_sk * esk),         \
+    (ss, ct, esk))                                                             \
+  X(dec, (uint8_t * ss, const uint8_t * ct, const uint8_t * sk), (ss, ct, sk)) \
+  X(dec_ws,                                                                    \
+    (uint8_t * ss, const uint8_t * ct, const uint8_t * sk,                     \
+     mlkem_workspace * ws),                                                    \
+    (ss, ct, sk, ws))                                                          \
+  X(dec_x4,                                                                    \
+    (uint8_t * ss[4], const uint8_t * ct[4], const uint8_t * sk[4]),           \
+    (ss, ct, sk))                                                              \
+  X(dec_batch,                                                                 \
+    (size_t n, uint8_t * ss[], const uint8_t * ct[], const uint8_t * sk[]),    \
+    (n, ss, ct, sk))
+
+#define MLKEM_DISPATCH_FIELD(name, params, args) int(*name) params;
+
+/* Table of the public API functions of one backend */
+typedef struct
+{
+  const char *name;
+  MLKEM_DISPATCH_API(MLKEM_DISPATCH_FIELD)
+} mlkem_backend;
+
+#define mlkem_backend_select MLKEM_NAMESPACE(backend_select)
+/*************************************************
+ * Name:        mlkem_backend_select
+ *
+ * Description: Queries the features of the host CPU and returns the
+ *              fastest backend it supports. Does not cache the result.
+ **************************************************/
+const mlkem_backend *mlkem_backend_select(void);
+
+#define mlkem_backend_get MLKEM_NAMESPACE(backend_get)
+/*************************************************
+ * Name:        mlkem_backend_get
+ *
+ * Description: Returns the backend used by the public API, selecting it
+ *              via mlkem_backend_select() on first use.
+ *
+ *              Thread-safe: the selected backend is stored atomically.
+ *              Concurrent first calls may each run the selection, but
+ *              they all store the same result. Multi-threaded callers
+ *              that want to avoid this can call mlkem_backend_get() once
+ *              before starting any threads.
+ **************************************************/
+const mlkem_backend *mlkem_backend_get(void);
+
+#endif /* MLKEM_NATIVE_DISPATCH */
+
+#endif
@@ -206,3 +206,181 @@ void sha3_512(uint8_t *output, const uint8_t *input, size_t inlen)
   /* Squeeze output */
   keccak_squeeze_once(output, 64, ctx, SHA3_512_RATE);
 }
+
+/*************************************************
+ * Name:        keccak_inc_init
+ *
+ * Description: Initializes an incremental Keccak context.
+ *
+ * Arguments:   - shake256incctx *c: pointer to (uninitialized) context
+ **************************************************/
+static void keccak_inc_init(shake256incctx *c)
+{
+  memset(c->ctx, 0, sizeof(c->ctx));
+  c->pos = 0;
+}
+
+/*************************************************
+ * Name:        keccak_inc_absorb
+ *
+ * Description: Incremental absorb step of Keccak. Permutes the state
+ *              whenever a block is complete, so that c->pos < r on return.
+ *
+ * Arguments:   - shake256incctx *c: pointer to in/output context
+ *              - uint32_t r:        rate in bytes (e.g., 136 for SHAKE256)
+ *              - const uint8_t *m:  pointer to input to be absorbed
+ *              - size_t mlen:       length of input in bytes
+ **************************************************/
+STATIC_TESTABLE
+void keccak_inc_absorb(shake256incctx *c, uint32_t r, const uint8_t *m,
+                       size_t mlen)
+__contract__(
+    requires(r <= sizeof(uint64_t) * KECCAK_LANES)
+    requires(memory_no_alias(c, sizeof(shake256incctx)))
+    requires(c->pos < r)
+    requires(memory_no_alias(m, mlen))
+    assigns(memory_slice(c, sizeof(shake256incctx)))
+    ensures(c->pos < r))
+{
+  unsigned int len;
+  while (mlen >= r - c->pos)
+  __loop__(
+    assigns(len, m, mlen, memory_slice(c, sizeof(shake256incctx)))
+    invariant(c->pos < r)
+    invariant(mlen <= loop_entry(mlen) &&
+      m == loop_entry(m) + (loop_entry(mlen) - mlen)))
+  {
+    len = r - c->pos;
+    KeccakF1600_StateXORBytes(c->ctx, m, c->pos, len);
+    KeccakF1600_StatePermute(c->ctx);
+    m += len;
+    mlen -= len;
+    c->pos = 0;
+  }
+
+  if (mlen > 0)
+  {
+    KeccakF1600_StateXORBytes(c->ctx, m, c->pos, (unsigned int)mlen);
+    c->pos += (unsigned int)mlen;
+  }
+}
+
+/*************************************************
+ * Name:        keccak_inc_finalize
+ *
+ * Description: Pads the absorbed input and prepares the context
+ *              for squeezing.
+ *
+ * Arguments:   - shake256incctx *c: pointer to in/output context
+ *              - uint32_t r:        rate in bytes (e.g., 136 for SHAKE256)
+ *              - uint8_t p:         domain-separation byte for different
+ *                                   Keccak-derived functions
+ **************************************************/
+STATIC_TESTABLE
+void keccak_inc_finalize(shake256incctx *c, uint32_t r, uint8_t p)
+__contract__(
+    requires(r <= sizeof(uint64_t) * KECCAK_LANES)
+    requires(memory_no_alias(c, sizeof(shake256incctx)))
+    requires(c->pos < r)
+    assigns(memory_slice(c, sizeof(shake256incctx)))
+    ensures(c->pos == 0))
+{
+  if (c->pos == r - 1)
+  {
+    p |= 128;
+    KeccakF1600_StateXORBytes(c->ctx, &p, c->pos, 1);
+  }
+  else
+  {
+    KeccakF1600_StateXORBytes(c->ctx, &p, c->pos, 1);
+    p = 128;
+    KeccakF1600_StateXORBytes(c->ctx, &p, r - 1, 1);
+  }
+  /* No output available until the next permutation */
+  c->pos = 0;
+}
+
+/*************************************************
+ * Name:        keccak_inc_squeeze
+ *
+ * Description: Incremental squeeze step of Keccak; can be called
+ *              on byte-level and multiple times.
+ *
+ * Arguments:   - uint8_t *h:        pointer to output bytes
+ *              - size_t outlen:     number of bytes to be squeezed
+ *              - shake256incctx *c: pointer to in/output context
+ *              - uint32_t r:        rate in bytes (e.g., 136 for SHAKE256)
+ **************************************************/
+STATIC_TESTABLE
+void keccak_inc_squeeze(uint8_t *h, size_t outlen, shake256incctx *c,
+                        uint32_t r)
+__contract__(
+    requires(0 < r && r <= sizeof(uint64_t) * KECCAK_LANES)
+    requires(memory_no_alias(c, sizeof(shake256incctx)))
+    requires(c->pos <= r)
+    requires(memory_no_alias(h, outlen))
+    assigns(memory_slice(c, sizeof(shake256incctx)))
+    assigns(memory_slice(h, outlen))
+    ensures(c->pos <= r))
+{
+  unsigned int len;
+  while (outlen > 0)
+  __loop__(
+    assigns(len, h, outlen,
+      memory_slice(c, sizeof(shake256incctx)),
+      memory_slice(h, outlen))
+    invariant(c->pos <= r)
+    invariant(outlen <= loop_entry(outlen) &&
+      h == loop_entry(h) + (loop_entry(outlen) - outlen)))
+  {
+    if (c->pos == 0)
+    {
+      KeccakF1600_StatePermute(c->ctx);
+      c->pos = r;
+    }
+
+    len = c->pos;
+    if (outlen < len)
+    {
+      len = (unsigned int)outlen;
+    }
+    KeccakF1600_StateExtractBytes(c->ctx, h, r - c->pos, len);
+    h += len;
+    outlen -= len;
+    c->pos -= len;
+  }
+}
+
+void shake256_inc_init(shake256incctx *state) { keccak_inc_init(state); }
+
+void shake256_inc_absorb(shake256incctx *state, const uint8_t *input,
+                         size_t inlen)
+{
+  keccak_inc_absorb(state, SHAKE256_RATE, input, inlen);
+}
+
+void shake256_inc_finalize(shake256incctx *state)
+{
+  keccak_inc_finalize(state, SHAKE256_RATE, 0x1F);
+}
+
+void shake256_inc_squeeze(uint8_t *output, size_t outlen,
+                          shake256incctx *state)
+{
+  keccak_inc_squeeze(output, outlen, state, SHAKE256_RATE);
+}
+
+void sha3_512_inc_init(sha3_512incctx *state) { keccak_inc_init(state); }
+
+void sha3_512_inc_absorb(sha3_512incctx *state, const uint8_t *input,
+                         size_t inlen)
+{
+  keccak_inc_absorb(state, SHA3_512_RATE, input, inlen);
+}
+
+void sha3_512_inc_finalize(uint8_t *output, sha3_512incctx *state)
+{
+  keccak_inc_finalize(state, SHA3_512_RATE, 0x06);
+  KeccakF1600_StatePermute(state->ctx);
+  KeccakF1600_StateExtractBytes(state->ctx, output, 0, SHA3_512_HASHBYTES);
+}
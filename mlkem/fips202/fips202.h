@@ -23,6 +23,16 @@ typedef struct
   uint64_t ctx[25];
 } shake128ctx;
 
+/* Context for incremental API */
+typedef struct
+{
+  uint64_t ctx[25];
+  /* Absorb: bytes absorbed into the current block;
+   * squeeze: bytes of the current block not yet squeezed */
+  unsigned int pos;
+} shake256incctx;
+typedef shake256incctx sha3_512incctx;
+
 /* Initialize the state and absorb the provided input.
  *
  * This function does not support being called multiple times
@@ -141,4 +151,137 @@ __contract__(
   assigns(memory_slice(output, SHA3_512_HASHBYTES))
 );
 
+
+#define shake256_inc_init FIPS202_NAMESPACE(shake256_inc_init)
+/*************************************************
+ * Name:        shake256_inc_init
+ *
+ * Description: Initializes an incremental SHAKE256 context.
+ *
+ * Arguments:   - shake256incctx *state: pointer to (uninitialized) context
+ **************************************************/
+void shake256_inc_init(shake256incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256incctx)))
+  assigns(memory_slice(state, sizeof(shake256incctx)))
+  ensures(state->pos == 0)
+);
+
+#define shake256_inc_absorb FIPS202_NAMESPACE(shake256_inc_absorb)
+/*************************************************
+ * Name:        shake256_inc_absorb
+ *
+ * Description: Absorbs input into an incremental SHAKE256 context.
+ *              Can be called multiple times; the input is the
+ *              concatenation of all chunks passed since
+ *              shake256_inc_init().
+ *
+ * Arguments:   - shake256incctx *state: pointer to in/output context
+ *              - const uint8_t *input:  pointer to input
+ *              - size_t inlen:          length of input in bytes
+ **************************************************/
+void shake256_inc_absorb(shake256incctx *state, const uint8_t *input,
+                         size_t inlen)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256incctx)))
+  requires(state->pos < SHAKE256_RATE)
+  requires(memory_no_alias(input, inlen))
+  assigns(memory_slice(state, sizeof(shake256incctx)))
+  ensures(state->pos < SHAKE256_RATE)
+);
+
+#define shake256_inc_finalize FIPS202_NAMESPACE(shake256_inc_finalize)
+/*************************************************
+ * Name:        shake256_inc_finalize
+ *
+ * Description: Pads the input absorbed into an incremental SHAKE256
+ *              context and switches it to squeezing.
+ *
+ * Arguments:   - shake256incctx *state: pointer to in/output context
+ **************************************************/
+void shake256_inc_finalize(shake256incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256incctx)))
+  requires(state->pos < SHAKE256_RATE)
+  assigns(memory_slice(state, sizeof(shake256incctx)))
+  ensures(state->pos == 0)
+);
+
+#define shake256_inc_squeeze FIPS202_NAMESPACE(shake256_inc_squeeze)
+/*************************************************
+ * Name:        shake256_inc_squeeze
+ *
+ * Description: Squeezes output from a finalized incremental SHAKE256
+ *              context. Can be called multiple times to keep squeezing.
+ *
+ * Arguments:   - uint8_t *output:       pointer to output
+ *              - size_t outlen:         requested output length in bytes
+ *              - shake256incctx *state: pointer to in/output context
+ **************************************************/
+void shake256_inc_squeeze(uint8_t *output, size_t outlen,
+                          shake256incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256incctx)))
+  requires(state->pos <= SHAKE256_RATE)
+  requires(memory_no_alias(output, outlen))
+  assigns(memory_slice(output, outlen))
+  assigns(memory_slice(state, sizeof(shake256incctx)))
+  ensures(state->pos <= SHAKE256_RATE)
+);
+
+#define sha3_512_inc_init FIPS202_NAMESPACE(sha3_512_inc_init)
+/*************************************************
+ * Name:        sha3_512_inc_init
+ *
+ * Description: Initializes an incremental SHA3-512 context.
+ *
+ * Arguments:   - sha3_512incctx *state: pointer to (uninitialized) context
+ **************************************************/
+void sha3_512_inc_init(sha3_512incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(sha3_512incctx)))
+  assigns(memory_slice(state, sizeof(sha3_512incctx)))
+  ensures(state->pos == 0)
+);
+
+#define sha3_512_inc_absorb FIPS202_NAMESPACE(sha3_512_inc_absorb)
+/*************************************************
+ * Name:        sha3_512_inc_absorb
+ *
+ * Description: Absorbs input into an incremental SHA3-512 context.
+ *              Can be called multiple times.
+ *
+ * Arguments:   - sha3_512incctx *state: pointer to in/output context
+ *              - const uint8_t *input:  pointer to input
+ *              - size_t inlen:          length of input in bytes
+ **************************************************/
+void sha3_512_inc_absorb(sha3_512incctx *state, const uint8_t *input,
+                         size_t inlen)
+__contract__(
+  requires(memory_no_alias(state, sizeof(sha3_512incctx)))
+  requires(state->pos < SHA3_512_RATE)
+  requires(memory_no_alias(input, inlen))
+  assigns(memory_slice(state, sizeof(sha3_512incctx)))
+  ensures(state->pos < SHA3_512_RATE)
+);
+
+#define sha3_512_inc_finalize FIPS202_NAMESPACE(sha3_512_inc_finalize)
+/*************************************************
+ * Name:        sha3_512_inc_finalize
+ *
+ * Description: Finishes an incremental SHA3-512 computation.
+ *
+ * Arguments:   - uint8_t *output:       pointer to output
+ *                                       (of length SHA3_512_HASHBYTES)
+ *              - sha3_512incctx *state: pointer to in/output context
+ **************************************************/
+void sha3_512_inc_finalize(uint8_t *output, sha3_512incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(sha3_512incctx)))
+  requires(state->pos < SHA3_512_RATE)
+  requires(memory_no_alias(output, SHA3_512_HASHBYTES))
+  assigns(memory_slice(output, SHA3_512_HASHBYTES))
+  assigns(memory_slice(state, sizeof(sha3_512incctx)))
+);
+
 #endif
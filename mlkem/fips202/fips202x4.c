@@ -9,11 +9,28 @@
 
 typedef shake128x4ctx shake256x4_ctx;
 
-static void keccak_absorb_once_x4(uint64_t *s, uint32_t r, const uint8_t *in0,
-                                  const uint8_t *in1, const uint8_t *in2,
-                                  const uint8_t *in3, size_t inlen, uint8_t p)
+STATIC_TESTABLE
+void keccak_absorb_once_x4(uint64_t *s, uint32_t r, const uint8_t *in0,
+                           const uint8_t *in1, const uint8_t *in2,
+                           const uint8_t *in3, size_t inlen, uint8_t p)
+__contract__(
+    requires(0 < r && r <= sizeof(uint64_t) * KECCAK_LANES)
+    requires(memory_no_alias(s, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    requires(readable(in0, inlen))
+    requires(readable(in1, inlen))
+    requires(readable(in2, inlen))
+    requires(readable(in3, inlen))
+    assigns(memory_slice(s, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY)))
 {
   while (inlen >= r)
+  __loop__(
+    assigns(inlen, in0, in1, in2, in3,
+      memory_slice(s, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    invariant(inlen <= loop_entry(inlen))
+    invariant(in0 == loop_entry(in0) + (loop_entry(inlen) - inlen))
+    invariant(in1 == loop_entry(in1) + (loop_entry(inlen) - inlen))
+    invariant(in2 == loop_entry(in2) + (loop_entry(inlen) - inlen))
+    invariant(in3 == loop_entry(in3) + (loop_entry(inlen) - inlen)))
   {
     KeccakF1600x4_StateXORBytes(s, in0, in1, in2, in3, 0, r);
     KeccakF1600x4_StatePermute(s);
@@ -123,3 +140,133 @@ void shake256x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
     memcpy(out3, tmp[3], outlen);
   }
 }
+
+void sha3_256x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                const uint8_t *in0, const uint8_t *in1, const uint8_t *in2,
+                const uint8_t *in3, size_t inlen)
+{
+  uint64_t ctx[KECCAK_LANES * KECCAK_WAY];
+  memset(ctx, 0, sizeof(ctx));
+  /* Absorb input */
+  keccak_absorb_once_x4(ctx, SHA3_256_RATE, in0, in1, in2, in3, inlen, 0x06);
+  /* Squeeze output */
+  KeccakF1600x4_StatePermute(ctx);
+  KeccakF1600x4_StateExtractBytes(ctx, out0, out1, out2, out3, 0,
+                                  SHA3_256_HASHBYTES);
+}
+
+void sha3_512x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                const uint8_t *in0, const uint8_t *in1, const uint8_t *in2,
+                const uint8_t *in3, size_t inlen)
+{
+  uint64_t ctx[KECCAK_LANES * KECCAK_WAY];
+  memset(ctx, 0, sizeof(ctx));
+  /* Absorb input */
+  keccak_absorb_once_x4(ctx, SHA3_512_RATE, in0, in1, in2, in3, inlen, 0x06);
+  /* Squeeze output */
+  KeccakF1600x4_StatePermute(ctx);
+  KeccakF1600x4_StateExtractBytes(ctx, out0, out1, out2, out3, 0,
+                                  SHA3_512_HASHBYTES);
+}
+
+void shake256x4_inc_init(shake256x4incctx *state)
+{
+  memset(state->ctx, 0, sizeof(state->ctx));
+  state->pos = 0;
+}
+
+void shake256x4_inc_absorb(shake256x4incctx *state, const uint8_t *in0,
+                           const uint8_t *in1, const uint8_t *in2,
+                           const uint8_t *in3, size_t inlen)
+{
+  unsigned int len;
+  while (inlen >= SHAKE256_RATE - state->pos)
+  __loop__(
+    assigns(len, in0, in1, in2, in3, inlen,
+      memory_slice(state, sizeof(shake256x4incctx)))
+    invariant(state->pos < SHAKE256_RATE)
+    invariant(inlen <= loop_entry(inlen))
+    invariant(in0 == loop_entry(in0) + (loop_entry(inlen) - inlen))
+    invariant(in1 == loop_entry(in1) + (loop_entry(inlen) - inlen))
+    invariant(in2 == loop_entry(in2) + (loop_entry(inlen) - inlen))
+    invariant(in3 == loop_entry(in3) + (loop_entry(inlen) - inlen)))
+  {
+    len = SHAKE256_RATE - state->pos;
+    KeccakF1600x4_StateXORBytes(state->ctx, in0, in1, in2, in3, state->pos,
+                                len);
+    KeccakF1600x4_StatePermute(state->ctx);
+
+    in0 += len;
+    in1 += len;
+    in2 += len;
+    in3 += len;
+    inlen -= len;
+    state->pos = 0;
+  }
+
+  if (inlen > 0)
+  {
+    KeccakF1600x4_StateXORBytes(state->ctx, in0, in1, in2, in3, state->pos,
+                                (unsigned int)inlen);
+    state->pos += (unsigned int)inlen;
+  }
+}
+
+void shake256x4_inc_finalize(shake256x4incctx *state)
+{
+  uint8_t p = 0x1F;
+  if (state->pos == SHAKE256_RATE - 1)
+  {
+    p |= 128;
+    KeccakF1600x4_StateXORBytes(state->ctx, &p, &p, &p, &p, state->pos, 1);
+  }
+  else
+  {
+    KeccakF1600x4_StateXORBytes(state->ctx, &p, &p, &p, &p, state->pos, 1);
+    p = 128;
+    KeccakF1600x4_StateXORBytes(state->ctx, &p, &p, &p, &p, SHAKE256_RATE - 1,
+                                1);
+  }
+  /* No output available until the next permutation */
+  state->pos = 0;
+}
+
+void shake256x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                            uint8_t *out3, size_t outlen,
+                            shake256x4incctx *state)
+{
+  unsigned int len;
+  while (outlen > 0)
+  __loop__(
+    assigns(len, out0, out1, out2, out3, outlen,
+      memory_slice(state, sizeof(shake256x4incctx)),
+      memory_slice(out0, outlen), memory_slice(out1, outlen),
+      memory_slice(out2, outlen), memory_slice(out3, outlen))
+    invariant(state->pos <= SHAKE256_RATE)
+    invariant(outlen <= loop_entry(outlen))
+    invariant(out0 == loop_entry(out0) + (loop_entry(outlen) - outlen))
+    invariant(out1 == loop_entry(out1) + (loop_entry(outlen) - outlen))
+    invariant(out2 == loop_entry(out2) + (loop_entry(outlen) - outlen))
+    invariant(out3 == loop_entry(out3) + (loop_entry(outlen) - outlen)))
+  {
+    if (state->pos == 0)
+    {
+      KeccakF1600x4_StatePermute(state->ctx);
+      state->pos = SHAKE256_RATE;
+    }
+
+    len = state->pos;
+    if (outlen < len)
+    {
+      len = (unsigned int)outlen;
+    }
+    KeccakF1600x4_StateExtractBytes(state->ctx, out0, out1, out2, out3,
+                                    SHAKE256_RATE - state->pos, len);
+    out0 += len;
+    out1 += len;
+    out2 += len;
+    out3 += len;
+    outlen -= len;
+    state->pos -= len;
+  }
+}
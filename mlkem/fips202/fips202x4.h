@@ -19,6 +19,14 @@ typedef struct
   uint64_t ctx[KECCAK_LANES * KECCAK_WAY];
 } shake128x4ctx;
 
+/* Context for incremental API */
+typedef struct
+{
+  uint64_t ctx[KECCAK_LANES * KECCAK_WAY];
+  /* Common position of all four instances, see shake256incctx */
+  unsigned int pos;
+} shake256x4incctx;
+
 #define shake128x4_absorb_once FIPS202_NAMESPACE(shake128x4_absorb_once)
 void shake128x4_absorb_once(shake128x4ctx *state, const uint8_t *in0,
                             const uint8_t *in1, const uint8_t *in2,
@@ -72,4 +80,159 @@ __contract__(
   assigns(memory_slice(out3, outlen))
 );
 
+#define sha3_256x4 FIPS202_NAMESPACE(sha3_256x4)
+/*************************************************
+ * Name:        sha3_256x4
+ *
+ * Description: Four-way parallel SHA3-256 with non-incremental API.
+ *              All four inputs must have the same length.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to outputs
+ *                (of length SHA3_256_HASHBYTES each)
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void sha3_256x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                const uint8_t *in0, const uint8_t *in1, const uint8_t *in2,
+                const uint8_t *in3, size_t inlen)
+/* The four lanes are typically rows of the same array, so we only
+   require the buffers to be readable or writeable. */
+__contract__(
+  requires(readable(in0, inlen))
+  requires(readable(in1, inlen))
+  requires(readable(in2, inlen))
+  requires(readable(in3, inlen))
+  requires(writeable(out0, SHA3_256_HASHBYTES))
+  requires(writeable(out1, SHA3_256_HASHBYTES))
+  requires(writeable(out2, SHA3_256_HASHBYTES))
+  requires(writeable(out3, SHA3_256_HASHBYTES))
+  assigns(memory_slice(out0, SHA3_256_HASHBYTES))
+  assigns(memory_slice(out1, SHA3_256_HASHBYTES))
+  assigns(memory_slice(out2, SHA3_256_HASHBYTES))
+  assigns(memory_slice(out3, SHA3_256_HASHBYTES))
+);
+
+#define sha3_512x4 FIPS202_NAMESPACE(sha3_512x4)
+/*************************************************
+ * Name:        sha3_512x4
+ *
+ * Description: Four-way parallel SHA3-512 with non-incremental API.
+ *              All four inputs must have the same length.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to outputs
+ *                (of length SHA3_512_HASHBYTES each)
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void sha3_512x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                const uint8_t *in0, const uint8_t *in1, const uint8_t *in2,
+                const uint8_t *in3, size_t inlen)
+/* The four lanes are typically rows of the same array, so we only
+   require the buffers to be readable or writeable. */
+__contract__(
+  requires(readable(in0, inlen))
+  requires(readable(in1, inlen))
+  requires(readable(in2, inlen))
+  requires(readable(in3, inlen))
+  requires(writeable(out0, SHA3_512_HASHBYTES))
+  requires(writeable(out1, SHA3_512_HASHBYTES))
+  requires(writeable(out2, SHA3_512_HASHBYTES))
+  requires(writeable(out3, SHA3_512_HASHBYTES))
+  assigns(memory_slice(out0, SHA3_512_HASHBYTES))
+  assigns(memory_slice(out1, SHA3_512_HASHBYTES))
+  assigns(memory_slice(out2, SHA3_512_HASHBYTES))
+  assigns(memory_slice(out3, SHA3_512_HASHBYTES))
+);
+
+
+#define shake256x4_inc_init FIPS202_NAMESPACE(shake256x4_inc_init)
+/*************************************************
+ * Name:        shake256x4_inc_init
+ *
+ * Description: Initializes a four-way incremental SHAKE256 context.
+ *
+ * Arguments:   - shake256x4incctx *state: pointer to (uninitialized) context
+ **************************************************/
+void shake256x4_inc_init(shake256x4incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256x4incctx)))
+  assigns(memory_slice(state, sizeof(shake256x4incctx)))
+  ensures(state->pos == 0)
+);
+
+#define shake256x4_inc_absorb FIPS202_NAMESPACE(shake256x4_inc_absorb)
+/*************************************************
+ * Name:        shake256x4_inc_absorb
+ *
+ * Description: Absorbs one chunk of input into each of the four
+ *              instances of an incremental SHAKE256 context.
+ *              All four chunks must have the same length.
+ *
+ * Arguments:   - shake256x4incctx *state: pointer to in/output context
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void shake256x4_inc_absorb(shake256x4incctx *state, const uint8_t *in0,
+                           const uint8_t *in1, const uint8_t *in2,
+                           const uint8_t *in3, size_t inlen)
+/* The inputs may all point into the same object, e.g. the same
+   private key or padded copies of one cipher text. */
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256x4incctx)))
+  requires(state->pos < SHAKE256_RATE)
+  requires(readable(in0, inlen))
+  requires(readable(in1, inlen))
+  requires(readable(in2, inlen))
+  requires(readable(in3, inlen))
+  assigns(memory_slice(state, sizeof(shake256x4incctx)))
+  ensures(state->pos < SHAKE256_RATE)
+);
+
+#define shake256x4_inc_finalize FIPS202_NAMESPACE(shake256x4_inc_finalize)
+/*************************************************
+ * Name:        shake256x4_inc_finalize
+ *
+ * Description: Pads the input absorbed into a four-way incremental
+ *              SHAKE256 context and switches it to squeezing.
+ *
+ * Arguments:   - shake256x4incctx *state: pointer to in/output context
+ **************************************************/
+void shake256x4_inc_finalize(shake256x4incctx *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256x4incctx)))
+  requires(state->pos < SHAKE256_RATE)
+  assigns(memory_slice(state, sizeof(shake256x4incctx)))
+  ensures(state->pos == 0)
+);
+
+#define shake256x4_inc_squeeze FIPS202_NAMESPACE(shake256x4_inc_squeeze)
+/*************************************************
+ * Name:        shake256x4_inc_squeeze
+ *
+ * Description: Squeezes output from a finalized four-way incremental
+ *              SHAKE256 context. Can be called multiple times.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to outputs
+ *              - size_t outlen: requested length of each output in bytes
+ *              - shake256x4incctx *state: pointer to in/output context
+ **************************************************/
+void shake256x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                            uint8_t *out3, size_t outlen,
+                            shake256x4incctx *state)
+/* As for sha3_256x4(), the outputs may be rows of the same array. */
+__contract__(
+  requires(memory_no_alias(state, sizeof(shake256x4incctx)))
+  requires(state->pos <= SHAKE256_RATE)
+  requires(writeable(out0, outlen))
+  requires(writeable(out1, outlen))
+  requires(writeable(out2, outlen))
+  requires(writeable(out3, outlen))
+  assigns(memory_slice(out0, outlen))
+  assigns(memory_slice(out1, outlen))
+  assigns(memory_slice(out2, outlen))
+  assigns(memory_slice(out3, outlen))
+  assigns(memory_slice(state, sizeof(shake256x4incctx)))
+  ensures(state->pos <= SHAKE256_RATE)
+);
+
 #endif
@@ -25,6 +25,9 @@
 void KeccakF1600_StateExtractBytes(uint64_t *state, unsigned char *data,
                                    unsigned int offset, unsigned int length)
 {
+#if defined(MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE)
+  keccak_f1600_extract_bytes_native(state, data, offset, length);
+#else  /* MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE */
   unsigned int i;
 #if defined(SYS_LITTLE_ENDIAN)
   uint8_t *state_ptr = (uint8_t *)state + offset;
@@ -40,11 +43,15 @@ void KeccakF1600_StateExtractBytes(uint64_t *state, unsigned char *data,
     data[i] = state[(offset + i) >> 3] >> (8 * ((offset + i) & 0x07));
   }
 #endif /* SYS_LITTLE_ENDIAN */
+#endif /* !MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE */
 }
 
 void KeccakF1600_StateXORBytes(uint64_t *state, const unsigned char *data,
                                unsigned int offset, unsigned int length)
 {
+#if defined(MLKEM_USE_FIPS202_XOR_BYTES_NATIVE)
+  keccak_f1600_xor_bytes_native(state, data, offset, length);
+#else  /* MLKEM_USE_FIPS202_XOR_BYTES_NATIVE */
   unsigned int i;
 #if defined(SYS_LITTLE_ENDIAN)
   uint8_t *state_ptr = (uint8_t *)state + offset;
@@ -61,6 +68,7 @@ void KeccakF1600_StateXORBytes(uint64_t *state, const unsigned char *data,
                                 << (8 * ((offset + i) & 0x07));
   }
 #endif /* SYS_LITTLE_ENDIAN */
+#endif /* !MLKEM_USE_FIPS202_XOR_BYTES_NATIVE */
 }
 
 void KeccakF1600x4_StateExtractBytes(uint64_t *state, unsigned char *data0,
@@ -68,6 +76,10 @@ void KeccakF1600x4_StateExtractBytes(uint64_t *state, unsigned char *data0,
                                      unsigned char *data3, unsigned int offset,
                                      unsigned int length)
 {
+#if defined(MLKEM_USE_FIPS202_X4_EXTRACT_BYTES_NATIVE)
+  keccak_f1600_x4_extract_bytes_native(state, data0, data1, data2, data3,
+                                       offset, length);
+#else
   KeccakF1600_StateExtractBytes(state + KECCAK_LANES * 0, data0, offset,
                                 length);
   KeccakF1600_StateExtractBytes(state + KECCAK_LANES * 1, data1, offset,
@@ -76,6 +88,7 @@ void KeccakF1600x4_StateExtractBytes(uint64_t *state, unsigned char *data0,
                                 length);
   KeccakF1600_StateExtractBytes(state + KECCAK_LANES * 3, data3, offset,
                                 length);
+#endif /* !MLKEM_USE_FIPS202_X4_EXTRACT_BYTES_NATIVE */
 }
 
 void KeccakF1600x4_StateXORBytes(uint64_t *state, const unsigned char *data0,
@@ -84,10 +97,39 @@ void KeccakF1600x4_StateXORBytes(uint64_t *state, const unsigned char *data0,
                                  const unsigned char *data3,
                                  unsigned int offset, unsigned int length)
 {
+#if defined(MLKEM_USE_FIPS202_X4_XOR_BYTES_NATIVE)
+  keccak_f1600_x4_xor_bytes_native(state, data0, data1, data2, data3, offset,
+                                   length);
+#else
   KeccakF1600_StateXORBytes(state + KECCAK_LANES * 0, data0, offset, length);
   KeccakF1600_StateXORBytes(state + KECCAK_LANES * 1, data1, offset, length);
   KeccakF1600_StateXORBytes(state + KECCAK_LANES * 2, data2, offset, length);
   KeccakF1600_StateXORBytes(state + KECCAK_LANES * 3, data3, offset, length);
+#endif /* !MLKEM_USE_FIPS202_X4_XOR_BYTES_NATIVE */
+}
+
+void KeccakF1600x4_LaneReset(uint64_t *state, unsigned int lane)
+{
+  unsigned int i;
+  for (i = 0; i < KECCAK_LANES; i++)
+  {
+    state[KECCAK_LANES * lane + i] = 0;
+  }
+}
+
+void KeccakF1600x4_LaneExtractBytes(uint64_t *state, unsigned int lane,
+                                    unsigned char *data, unsigned int offset,
+                                    unsigned int length)
+{
+  KeccakF1600_StateExtractBytes(state + KECCAK_LANES * lane, data, offset,
+                                length);
+}
+
+void KeccakF1600x4_LaneXORBytes(uint64_t *state, unsigned int lane,
+                                const unsigned char *data, unsigned int offset,
+                                unsigned int length)
+{
+  KeccakF1600_StateXORBytes(state + KECCAK_LANES * lane, data, offset, length);
 }
 
 void KeccakF1600x4_StatePermute(uint64_t *state)
@@ -105,6 +147,33 @@ void KeccakF1600x4_StatePermute(uint64_t *state)
 #endif /* !MLKEM_USE_FIPS202_X2_NATIVE && !MLKEM_USE_FIPS202_X4_NATIVE */
 }
 
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE)
+void KeccakF1600x8_LaneReset(uint64_t *state, unsigned int lane)
+{
+  KeccakF1600x4_LaneReset(state, lane);
+}
+
+void KeccakF1600x8_LaneExtractBytes(uint64_t *state, unsigned int lane,
+                                    unsigned char *data, unsigned int offset,
+                                    unsigned int length)
+{
+  KeccakF1600_StateExtractBytes(state + KECCAK_LANES * lane, data, offset,
+                                length);
+}
+
+void KeccakF1600x8_LaneXORBytes(uint64_t *state, unsigned int lane,
+                                const unsigned char *data, unsigned int offset,
+                                unsigned int length)
+{
+  KeccakF1600_StateXORBytes(state + KECCAK_LANES * lane, data, offset, length);
+}
+
+void KeccakF1600x8_StatePermute(uint64_t *state)
+{
+  keccak_f1600_x8_native(state);
+}
+#endif /* MLKEM_USE_FIPS202_X8_NATIVE */
+
 #if !defined(MLKEM_USE_FIPS202_X1_NATIVE)
 static const uint64_t KeccakF_RoundConstants[NROUNDS] = {
     (uint64_t)0x0000000000000001ULL, (uint64_t)0x0000000000008082ULL,
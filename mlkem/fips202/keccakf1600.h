@@ -45,7 +45,22 @@ __contract__(
 void KeccakF1600x4_StateExtractBytes(uint64_t *state, unsigned char *data0,
                                      unsigned char *data1, unsigned char *data2,
                                      unsigned char *data3, unsigned int offset,
-                                     unsigned int length);
+                                     unsigned int length)
+/* The four lanes are typically rows of the same array, so we only
+   require them to be writeable. */
+__contract__(
+    requires(0 <= offset && offset <= KECCAK_LANES * sizeof(uint64_t) &&
+	     0 <= length && length <= KECCAK_LANES * sizeof(uint64_t) - offset)
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    requires(writeable(data0, length))
+    requires(writeable(data1, length))
+    requires(writeable(data2, length))
+    requires(writeable(data3, length))
+    assigns(memory_slice(data0, length))
+    assigns(memory_slice(data1, length))
+    assigns(memory_slice(data2, length))
+    assigns(memory_slice(data3, length))
+);
 
 #define KeccakF1600x4_StateXORBytes \
   FIPS202_NAMESPACE(KeccakF1600x4_StateXORBytes)
@@ -53,10 +68,90 @@ void KeccakF1600x4_StateXORBytes(uint64_t *state, const unsigned char *data0,
                                  const unsigned char *data1,
                                  const unsigned char *data2,
                                  const unsigned char *data3,
-                                 unsigned int offset, unsigned int length);
+                                 unsigned int offset, unsigned int length)
+/* As for KeccakF1600x4_StateExtractBytes(), the lanes need not be
+   distinct objects. */
+__contract__(
+    requires(0 <= offset && offset <= KECCAK_LANES * sizeof(uint64_t) &&
+	     0 <= length && length <= KECCAK_LANES * sizeof(uint64_t) - offset)
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    requires(readable(data0, length))
+    requires(readable(data1, length))
+    requires(readable(data2, length))
+    requires(readable(data3, length))
+    assigns(memory_slice(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+);
+
+#define KeccakF1600x4_LaneReset FIPS202_NAMESPACE(KeccakF1600x4_LaneReset)
+/*
+ * Single-lane access to a 4-fold Keccak state. These allow the lanes of a
+ * 4-fold state to run independent sponges (with different rates and domain
+ * separators) which are only synchronized at calls to
+ * KeccakF1600x4_StatePermute().
+ */
+void KeccakF1600x4_LaneReset(uint64_t *state, unsigned int lane)
+__contract__(
+    requires(lane < KECCAK_WAY)
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    assigns(memory_slice(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+);
+
+#define KeccakF1600x4_LaneExtractBytes \
+  FIPS202_NAMESPACE(KeccakF1600x4_LaneExtractBytes)
+void KeccakF1600x4_LaneExtractBytes(uint64_t *state, unsigned int lane,
+                                    unsigned char *data, unsigned int offset,
+                                    unsigned int length)
+__contract__(
+    requires(lane < KECCAK_WAY)
+    requires(0 <= offset && offset <= KECCAK_LANES * sizeof(uint64_t) &&
+	     0 <= length && length <= KECCAK_LANES * sizeof(uint64_t) - offset)
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    requires(memory_no_alias(data, length))
+    assigns(memory_slice(data, length))
+);
+
+#define KeccakF1600x4_LaneXORBytes FIPS202_NAMESPACE(KeccakF1600x4_LaneXORBytes)
+void KeccakF1600x4_LaneXORBytes(uint64_t *state, unsigned int lane,
+                                const unsigned char *data, unsigned int offset,
+                                unsigned int length)
+__contract__(
+    requires(lane < KECCAK_WAY)
+    requires(0 <= offset && offset <= KECCAK_LANES * sizeof(uint64_t) &&
+	     0 <= length && length <= KECCAK_LANES * sizeof(uint64_t) - offset)
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    requires(memory_no_alias(data, length))
+    assigns(memory_slice(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+);
 
 #define KeccakF1600x4_StatePermute FIPS202_NAMESPACE(KeccakF1600x4_StatePermute)
-void KeccakF1600x4_StatePermute(uint64_t *state);
+void KeccakF1600x4_StatePermute(uint64_t *state)
+__contract__(
+    requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+    assigns(memory_slice(state, sizeof(uint64_t) * KECCAK_LANES * KECCAK_WAY))
+);
+
+#define KeccakF1600x8_LaneReset FIPS202_NAMESPACE(KeccakF1600x8_LaneReset)
+/*
+ * 8-fold Keccak state, stored as 8 consecutive 1-fold states. Only
+ * implemented if the FIPS202 backend provides a native 8-fold permutation
+ * (MLKEM_USE_FIPS202_X8_NATIVE), in which case sample_jobs() runs on an
+ * 8-fold state.
+ */
+void KeccakF1600x8_LaneReset(uint64_t *state, unsigned int lane);
+
+#define KeccakF1600x8_LaneExtractBytes \
+  FIPS202_NAMESPACE(KeccakF1600x8_LaneExtractBytes)
+void KeccakF1600x8_LaneExtractBytes(uint64_t *state, unsigned int lane,
+                                    unsigned char *data, unsigned int offset,
+                                    unsigned int length);
+
+#define KeccakF1600x8_LaneXORBytes FIPS202_NAMESPACE(KeccakF1600x8_LaneXORBytes)
+void KeccakF1600x8_LaneXORBytes(uint64_t *state, unsigned int lane,
+                                const unsigned char *data, unsigned int offset,
+                                unsigned int length);
+
+#define KeccakF1600x8_StatePermute FIPS202_NAMESPACE(KeccakF1600x8_StatePermute)
+void KeccakF1600x8_StatePermute(uint64_t *state);
 
 #if !defined(MLKEM_USE_FIPS202_X1_ASM)
 #define KeccakF1600_StatePermute FIPS202_NAMESPACE(KeccakF1600_StatePermute)
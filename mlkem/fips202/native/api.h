@@ -25,10 +25,30 @@
  *
  * A _backend_ is a specific implementation of parts of this interface.
  *
- * You can replace 1-fold, 2-fold, or 4-fold batched Keccak-F1600.
- * To enable, set MLKEM_USE_FIPS202_X{1,2,4}_NATIVE in your backend,
- * and define the inline wrapper keccak_f1600_x{1,2,4}_native() to
+ * You can replace 1-fold, 2-fold, 4-fold, or 8-fold batched Keccak-F1600.
+ * To enable, set MLKEM_USE_FIPS202_X{1,2,4,8}_NATIVE in your backend,
+ * and define the inline wrapper keccak_f1600_x{1,2,4,8}_native() to
  * forward to your implementation.
+ *
+ * Batched Keccak states are stored one after the other in memory, that is,
+ * the k-th state occupies state[25 * k], ..., state[25 * k + 24].
+ *
+ * If 8-fold batched Keccak-F1600 is available, it is used to sample up to
+ * eight polynomials at once, e.g. in the generation of the matrix A.
+ * Since this determines the size of sample_workspace in sampling.h, and
+ * hence the layout of the workspaces built on it, set
+ * MLKEM_USE_FIPS202_X8_NATIVE in the backend profile rather than in the
+ * implementation header; the profile is visible in all source files.
+ *
+ * You can also replace the absorption of input into and the extraction of
+ * output from 1-fold and 4-fold Keccak states, by setting
+ * MLKEM_USE_FIPS202_{XOR,EXTRACT}_BYTES_NATIVE and/or
+ * MLKEM_USE_FIPS202_X4_{XOR,EXTRACT}_BYTES_NATIVE and defining the
+ * corresponding inline wrappers below. They XOR data into, or copy data out
+ * of, bytes offset, ..., offset + length - 1 of each state, where the bytes
+ * of a state are its 25 lanes in little-endian order, and
+ * offset + length <= 200. The 1-fold variants are also used to access
+ * single lanes of batched states.
  */
 
 #if defined(MLKEM_USE_FIPS202_X1_NATIVE)
@@ -40,5 +60,33 @@ static INLINE void keccak_f1600_x2_native(uint64_t *state);
 #if defined(MLKEM_USE_FIPS202_X4_NATIVE)
 static INLINE void keccak_f1600_x4_native(uint64_t *state);
 #endif
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE)
+static INLINE void keccak_f1600_x8_native(uint64_t *state);
+#endif
+
+#if defined(MLKEM_USE_FIPS202_XOR_BYTES_NATIVE)
+static INLINE void keccak_f1600_xor_bytes_native(uint64_t *state,
+                                                 const unsigned char *data,
+                                                 unsigned int offset,
+                                                 unsigned int length);
+#endif
+#if defined(MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE)
+static INLINE void keccak_f1600_extract_bytes_native(uint64_t *state,
+                                                     unsigned char *data,
+                                                     unsigned int offset,
+                                                     unsigned int length);
+#endif
+#if defined(MLKEM_USE_FIPS202_X4_XOR_BYTES_NATIVE)
+static INLINE void keccak_f1600_x4_xor_bytes_native(
+    uint64_t *state, const unsigned char *data0, const unsigned char *data1,
+    const unsigned char *data2, const unsigned char *data3,
+    unsigned int offset, unsigned int length);
+#endif
+#if defined(MLKEM_USE_FIPS202_X4_EXTRACT_BYTES_NATIVE)
+static INLINE void keccak_f1600_x4_extract_bytes_native(
+    uint64_t *state, unsigned char *data0, unsigned char *data1,
+    unsigned char *data2, unsigned char *data3, unsigned int offset,
+    unsigned int length);
+#endif
 
 #endif /* MLKEM_NATIVE_FIPS202_NATIVE_API_H */
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* FIPS202 profile for x86_64 systems with AVX-512 */
+
+#ifdef MLKEM_NATIVE_FIPS202_PROFILE_H
+#error Only one FIPS202 assembly profile can be defined -- did you include multiple profiles?
+#else
+#define MLKEM_NATIVE_FIPS202_PROFILE_H
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512
+
+#define MLKEM_NATIVE_FIPS202_BACKEND_NAME X86_64_AVX512
+
+/* Filename of the C backend implementation.
+ * This is not inlined here because this header is included in assembly
+ * files as well. */
+#define MLKEM_NATIVE_FIPS202_BACKEND_IMPL "x86_64/src/avx512_fips202_impl.h"
+
+/* 8-fold Keccak using AVX-512. Set here rather than in the implementation,
+ * see api.h. */
+#define MLKEM_USE_FIPS202_X8_NATIVE
+
+#endif /* MLKEM_NATIVE_FIPS202_PROFILE_H */
@@ -21,11 +21,12 @@ http://creativecommons.org/publicdomain/zero/1.0/
 /*
  * Changes for mlkem-native:
  * - copyFromState and copyToState operate on uninterleaved
- *   Keccak states in memory.
+ *   Keccak states in memory, using 4x4 transposes.
  */
 
 #include "common.h"
-#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP)
+#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP) || \
+    defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512)
 
 #include <emmintrin.h>
 #include <immintrin.h>
@@ -326,78 +327,85 @@ static ALIGN(KeccakP1600times4_statesAlignment) const UINT64
 
 #include <stdint.h>
 
-#define copyFromState(X, state)                                             \
-  do                                                                        \
-  {                                                                         \
-    const uint64_t *state64 = (const uint64_t *)(state);                    \
-    __m256i _idx =                                                          \
-        _mm256_set_epi64x((long long)&state64[75], (long long)&state64[50], \
-                          (long long)&state64[25], (long long)&state64[0]); \
-    X##ba = _mm256_i64gather_epi64((long long *)(0 * 8), _idx, 1);          \
-    X##be = _mm256_i64gather_epi64((long long *)(1 * 8), _idx, 1);          \
-    X##bi = _mm256_i64gather_epi64((long long *)(2 * 8), _idx, 1);          \
-    X##bo = _mm256_i64gather_epi64((long long *)(3 * 8), _idx, 1);          \
-    X##bu = _mm256_i64gather_epi64((long long *)(4 * 8), _idx, 1);          \
-    X##ga = _mm256_i64gather_epi64((long long *)(5 * 8), _idx, 1);          \
-    X##ge = _mm256_i64gather_epi64((long long *)(6 * 8), _idx, 1);          \
-    X##gi = _mm256_i64gather_epi64((long long *)(7 * 8), _idx, 1);          \
-    X##go = _mm256_i64gather_epi64((long long *)(8 * 8), _idx, 1);          \
-    X##gu = _mm256_i64gather_epi64((long long *)(9 * 8), _idx, 1);          \
-    X##ka = _mm256_i64gather_epi64((long long *)(10 * 8), _idx, 1);         \
-    X##ke = _mm256_i64gather_epi64((long long *)(11 * 8), _idx, 1);         \
-    X##ki = _mm256_i64gather_epi64((long long *)(12 * 8), _idx, 1);         \
-    X##ko = _mm256_i64gather_epi64((long long *)(13 * 8), _idx, 1);         \
-    X##ku = _mm256_i64gather_epi64((long long *)(14 * 8), _idx, 1);         \
-    X##ma = _mm256_i64gather_epi64((long long *)(15 * 8), _idx, 1);         \
-    X##me = _mm256_i64gather_epi64((long long *)(16 * 8), _idx, 1);         \
-    X##mi = _mm256_i64gather_epi64((long long *)(17 * 8), _idx, 1);         \
-    X##mo = _mm256_i64gather_epi64((long long *)(18 * 8), _idx, 1);         \
-    X##mu = _mm256_i64gather_epi64((long long *)(19 * 8), _idx, 1);         \
-    X##sa = _mm256_i64gather_epi64((long long *)(20 * 8), _idx, 1);         \
-    X##se = _mm256_i64gather_epi64((long long *)(21 * 8), _idx, 1);         \
-    X##si = _mm256_i64gather_epi64((long long *)(22 * 8), _idx, 1);         \
-    X##so = _mm256_i64gather_epi64((long long *)(23 * 8), _idx, 1);         \
-    X##su = _mm256_i64gather_epi64((long long *)(24 * 8), _idx, 1);         \
-  } while (0);
+/*
+ * Load lanes i, ..., i + 3 of the four uninterleaved states at state64
+ * into X0, ..., X3, transposing 4x4 64-bit words.
+ */
+#define LOAD_TRANSPOSE4(X0, X1, X2, X3, state64, i)               \
+  do                                                              \
+  {                                                               \
+    const uint64_t *_p = (state64) + (i);                         \
+    __m256i _t0 = _mm256_loadu_si256((const __m256i *)(_p + 0));  \
+    __m256i _t1 = _mm256_loadu_si256((const __m256i *)(_p + 25)); \
+    __m256i _t2 = _mm256_loadu_si256((const __m256i *)(_p + 50)); \
+    __m256i _t3 = _mm256_loadu_si256((const __m256i *)(_p + 75)); \
+    __m256i _u0 = _mm256_unpacklo_epi64(_t0, _t1);                \
+    __m256i _u1 = _mm256_unpackhi_epi64(_t0, _t1);                \
+    __m256i _u2 = _mm256_unpacklo_epi64(_t2, _t3);                \
+    __m256i _u3 = _mm256_unpackhi_epi64(_t2, _t3);                \
+    X0 = _mm256_permute2x128_si256(_u0, _u2, 0x20);               \
+    X1 = _mm256_permute2x128_si256(_u1, _u3, 0x20);               \
+    X2 = _mm256_permute2x128_si256(_u0, _u2, 0x31);               \
+    X3 = _mm256_permute2x128_si256(_u1, _u3, 0x31);               \
+  } while (0)
 
-#define SCATTER_STORE256(state, idx, v)                        \
-  do                                                           \
-  {                                                            \
-    const uint64_t *state64 = (const uint64_t *)(state);       \
-    __m128d t = _mm_castsi128_pd(_mm256_castsi256_si128((v))); \
-    _mm_storel_pd((double *)&state64[0 + (idx)], t);           \
-    _mm_storeh_pd((double *)&state64[25 + (idx)], t);          \
-    t = _mm_castsi128_pd(_mm256_extracti128_si256((v), 1));    \
-    _mm_storel_pd((double *)&state64[50 + (idx)], t);          \
-    _mm_storeh_pd((double *)&state64[75 + (idx)], t);          \
+/* Inverse of LOAD_TRANSPOSE4 */
+#define TRANSPOSE4_STORE(state64, i, X0, X1, X2, X3)                \
+  do                                                                \
+  {                                                                 \
+    uint64_t *_p = (state64) + (i);                                 \
+    __m256i _u0 = _mm256_unpacklo_epi64(X0, X1);                    \
+    __m256i _u1 = _mm256_unpackhi_epi64(X0, X1);                    \
+    __m256i _u2 = _mm256_unpacklo_epi64(X2, X3);                    \
+    __m256i _u3 = _mm256_unpackhi_epi64(X2, X3);                    \
+    _mm256_storeu_si256((__m256i *)(_p + 0),                        \
+                        _mm256_permute2x128_si256(_u0, _u2, 0x20)); \
+    _mm256_storeu_si256((__m256i *)(_p + 25),                       \
+                        _mm256_permute2x128_si256(_u1, _u3, 0x20)); \
+    _mm256_storeu_si256((__m256i *)(_p + 50),                       \
+                        _mm256_permute2x128_si256(_u0, _u2, 0x31)); \
+    _mm256_storeu_si256((__m256i *)(_p + 75),                       \
+                        _mm256_permute2x128_si256(_u1, _u3, 0x31)); \
   } while (0)
 
-#define copyToState(state, X)         \
-  SCATTER_STORE256(state, 0, X##ba);  \
-  SCATTER_STORE256(state, 1, X##be);  \
-  SCATTER_STORE256(state, 2, X##bi);  \
-  SCATTER_STORE256(state, 3, X##bo);  \
-  SCATTER_STORE256(state, 4, X##bu);  \
-  SCATTER_STORE256(state, 5, X##ga);  \
-  SCATTER_STORE256(state, 6, X##ge);  \
-  SCATTER_STORE256(state, 7, X##gi);  \
-  SCATTER_STORE256(state, 8, X##go);  \
-  SCATTER_STORE256(state, 9, X##gu);  \
-  SCATTER_STORE256(state, 10, X##ka); \
-  SCATTER_STORE256(state, 11, X##ke); \
-  SCATTER_STORE256(state, 12, X##ki); \
-  SCATTER_STORE256(state, 13, X##ko); \
-  SCATTER_STORE256(state, 14, X##ku); \
-  SCATTER_STORE256(state, 15, X##ma); \
-  SCATTER_STORE256(state, 16, X##me); \
-  SCATTER_STORE256(state, 17, X##mi); \
-  SCATTER_STORE256(state, 18, X##mo); \
-  SCATTER_STORE256(state, 19, X##mu); \
-  SCATTER_STORE256(state, 20, X##sa); \
-  SCATTER_STORE256(state, 21, X##se); \
-  SCATTER_STORE256(state, 22, X##si); \
-  SCATTER_STORE256(state, 23, X##so); \
-  SCATTER_STORE256(state, 24, X##su);
+/*
+ * Lanes 0, ..., 23 are moved in groups of four using 4x4 transposes;
+ * this is cheaper than gathering / scattering each lane separately.
+ */
+#define copyFromState(X, state)                               \
+  do                                                          \
+  {                                                           \
+    const uint64_t *state64 = (const uint64_t *)(state);      \
+    LOAD_TRANSPOSE4(X##ba, X##be, X##bi, X##bo, state64, 0);  \
+    LOAD_TRANSPOSE4(X##bu, X##ga, X##ge, X##gi, state64, 4);  \
+    LOAD_TRANSPOSE4(X##go, X##gu, X##ka, X##ke, state64, 8);  \
+    LOAD_TRANSPOSE4(X##ki, X##ko, X##ku, X##ma, state64, 12); \
+    LOAD_TRANSPOSE4(X##me, X##mi, X##mo, X##mu, state64, 16); \
+    LOAD_TRANSPOSE4(X##sa, X##se, X##si, X##so, state64, 20); \
+    X##su = _mm256_set_epi64x((long long)state64[99],         \
+                              (long long)state64[74],         \
+                              (long long)state64[49],         \
+                              (long long)state64[24]);        \
+  } while (0);
+
+#define copyToState(state, X)                                     \
+  do                                                              \
+  {                                                               \
+    uint64_t *state64 = (uint64_t *)(state);                      \
+    __m128i _lo, _hi;                                             \
+    TRANSPOSE4_STORE(state64, 0, X##ba, X##be, X##bi, X##bo);     \
+    TRANSPOSE4_STORE(state64, 4, X##bu, X##ga, X##ge, X##gi);     \
+    TRANSPOSE4_STORE(state64, 8, X##go, X##gu, X##ka, X##ke);     \
+    TRANSPOSE4_STORE(state64, 12, X##ki, X##ko, X##ku, X##ma);    \
+    TRANSPOSE4_STORE(state64, 16, X##me, X##mi, X##mo, X##mu);    \
+    TRANSPOSE4_STORE(state64, 20, X##sa, X##se, X##si, X##so);    \
+    _lo = _mm256_castsi256_si128(X##su);                          \
+    _hi = _mm256_extracti128_si256(X##su, 1);                     \
+    _mm_storel_pd((double *)&state64[24], _mm_castsi128_pd(_lo)); \
+    _mm_storeh_pd((double *)&state64[49], _mm_castsi128_pd(_lo)); \
+    _mm_storel_pd((double *)&state64[74], _mm_castsi128_pd(_hi)); \
+    _mm_storeh_pd((double *)&state64[99], _mm_castsi128_pd(_hi)); \
+  } while (0);
 
 #define copyStateVariables(X, Y) \
   X##ba = Y##ba;                 \
@@ -450,4 +458,5 @@ void KeccakP1600times4_PermuteAll_24rounds(void *states)
 #define empty_cu_avx2_keccakx4 FIPS202_NAMESPACE(empty_cu_avx2_keccakx4)
 int empty_cu_avx2_keccakx4;
 
-#endif /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP */
+#endif /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP || \
+          MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
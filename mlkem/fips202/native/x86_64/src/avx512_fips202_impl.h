@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* FIPS202 profile for x86_64 systems with AVX-512 */
+
+#ifdef MLKEM_NATIVE_FIPS202_PROFILE_IMPL_H
+#error Only one FIPS202 assembly profile can be defined -- did you include multiple profiles?
+#else
+#define MLKEM_NATIVE_FIPS202_PROFILE_IMPL_H
+
+#include "KeccakP-1600-times4-SnP.h"
+#include "keccak_f1600_bytes_avx2.h"
+#include "keccak_f1600_x1_bmi.h"
+#include "keccak_f1600_x8_avx512.h"
+
+/* Scalar Keccak using BMI1/BMI2, as in the default x86_64 profile */
+#define MLKEM_USE_FIPS202_X1_NATIVE
+static INLINE void keccak_f1600_x1_native(uint64_t *state)
+{
+  keccak_f1600_x1_bmi(state);
+}
+
+/* 4-fold Keccak from XKCP, as in the default x86_64 profile */
+#define MLKEM_USE_FIPS202_X4_NATIVE
+static INLINE void keccak_f1600_x4_native(uint64_t *state)
+{
+  KeccakP1600times4_PermuteAll_24rounds(state);
+}
+
+/* MLKEM_USE_FIPS202_X8_NATIVE is set in the profile, see api.h */
+static INLINE void keccak_f1600_x8_native(uint64_t *state)
+{
+  keccak_f1600_x8_avx512(state);
+}
+
+/* Word-oriented absorb and squeeze using AVX2, as in the default x86_64
+ * profile */
+#define MLKEM_USE_FIPS202_XOR_BYTES_NATIVE
+static INLINE void keccak_f1600_xor_bytes_native(uint64_t *state,
+                                                 const unsigned char *data,
+                                                 unsigned int offset,
+                                                 unsigned int length)
+{
+  keccak_f1600_xor_bytes_avx2(state, data, offset, length);
+}
+
+#define MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE
+static INLINE void keccak_f1600_extract_bytes_native(uint64_t *state,
+                                                     unsigned char *data,
+                                                     unsigned int offset,
+                                                     unsigned int length)
+{
+  keccak_f1600_extract_bytes_avx2(state, data, offset, length);
+}
+
+#define MLKEM_USE_FIPS202_X4_XOR_BYTES_NATIVE
+static INLINE void keccak_f1600_x4_xor_bytes_native(
+    uint64_t *state, const unsigned char *data0, const unsigned char *data1,
+    const unsigned char *data2, const unsigned char *data3,
+    unsigned int offset, unsigned int length)
+{
+  keccak_f1600_x4_xor_bytes_avx2(state, data0, data1, data2, data3, offset,
+                                 length);
+}
+
+#define MLKEM_USE_FIPS202_X4_EXTRACT_BYTES_NATIVE
+static INLINE void keccak_f1600_x4_extract_bytes_native(
+    uint64_t *state, unsigned char *data0, unsigned char *data1,
+    unsigned char *data2, unsigned char *data3, unsigned int offset,
+    unsigned int length)
+{
+  keccak_f1600_x4_extract_bytes_avx2(state, data0, data1, data2, data3,
+                                     offset, length);
+}
+
+#endif /* MLKEM_NATIVE_FIPS202_PROFILE_IMPL_H */
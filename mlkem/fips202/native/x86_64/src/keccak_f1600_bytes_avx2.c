@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Absorbing into and squeezing from 1-fold and 4-fold Keccak states
+ * using AVX2.
+ *
+ * The states are stored one after the other, as the FIPS202 backend API
+ * prescribes, so each state is a contiguous run of 200 bytes. The bulk of
+ * the data is moved 32 bytes at a time, followed by 8-byte words, and only
+ * the last few bytes are handled one at a time. The 4-fold variants move
+ * the four states in lock-step to hide load latencies.
+ *
+ * This requires a little-endian target, which x86_64 is.
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP) || \
+    defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512)
+
+#if !defined(__AVX2__)
+#error This file must be compiled with AVX2
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "keccak_f1600_bytes_avx2.h"
+
+/* Size of a single Keccak state in bytes */
+#define STATE_BYTES 200
+
+/* dst[0..31] ^= src[0..31] */
+#define XOR32(dst, src)                                            \
+  _mm256_storeu_si256(                                             \
+      (__m256i *)(dst),                                            \
+      _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(dst)), \
+                       _mm256_loadu_si256((const __m256i *)(src))))
+
+/* dst[0..7] ^= src[0..7] */
+#define XOR8(dst, src)                                                    \
+  _mm_storel_epi64((__m128i *)(dst),                                      \
+                   _mm_xor_si128(_mm_loadl_epi64((const __m128i *)(dst)), \
+                                 _mm_loadl_epi64((const __m128i *)(src))))
+
+/* dst[0..31] = src[0..31] */
+#define COPY32(dst, src)                \
+  _mm256_storeu_si256((__m256i *)(dst), \
+                      _mm256_loadu_si256((const __m256i *)(src)))
+
+/* dst[0..7] = src[0..7] */
+#define COPY8(dst, src) \
+  _mm_storel_epi64((__m128i *)(dst), _mm_loadl_epi64((const __m128i *)(src)))
+
+void keccak_f1600_xor_bytes_avx2(uint64_t *state, const unsigned char *data,
+                                 unsigned int offset, unsigned int length)
+{
+  unsigned char *s = (unsigned char *)state + offset;
+  unsigned int i = 0;
+
+  for (; i + 32 <= length; i += 32)
+  {
+    XOR32(s + i, data + i);
+  }
+  for (; i + 8 <= length; i += 8)
+  {
+    XOR8(s + i, data + i);
+  }
+  for (; i < length; i++)
+  {
+    s[i] ^= data[i];
+  }
+}
+
+void keccak_f1600_extract_bytes_avx2(uint64_t *state, unsigned char *data,
+                                     unsigned int offset, unsigned int length)
+{
+  const unsigned char *s = (const unsigned char *)state + offset;
+  unsigned int i = 0;
+
+  for (; i + 32 <= length; i += 32)
+  {
+    COPY32(data + i, s + i);
+  }
+  for (; i + 8 <= length; i += 8)
+  {
+    COPY8(data + i, s + i);
+  }
+  for (; i < length; i++)
+  {
+    data[i] = s[i];
+  }
+}
+
+void keccak_f1600_x4_xor_bytes_avx2(uint64_t *state,
+                                    const unsigned char *data0,
+                                    const unsigned char *data1,
+                                    const unsigned char *data2,
+                                    const unsigned char *data3,
+                                    unsigned int offset, unsigned int length)
+{
+  unsigned char *s0 = (unsigned char *)state + offset;
+  unsigned char *s1 = s0 + 1 * STATE_BYTES;
+  unsigned char *s2 = s0 + 2 * STATE_BYTES;
+  unsigned char *s3 = s0 + 3 * STATE_BYTES;
+  unsigned int i = 0;
+
+  for (; i + 32 <= length; i += 32)
+  {
+    XOR32(s0 + i, data0 + i);
+    XOR32(s1 + i, data1 + i);
+    XOR32(s2 + i, data2 + i);
+    XOR32(s3 + i, data3 + i);
+  }
+  for (; i + 8 <= length; i += 8)
+  {
+    XOR8(s0 + i, data0 + i);
+    XOR8(s1 + i, data1 + i);
+    XOR8(s2 + i, data2 + i);
+    XOR8(s3 + i, data3 + i);
+  }
+  for (; i < length; i++)
+  {
+    s0[i] ^= data0[i];
+    s1[i] ^= data1[i];
+    s2[i] ^= data2[i];
+    s3[i] ^= data3[i];
+  }
+}
+
+void keccak_f1600_x4_extract_bytes_avx2(uint64_t *state, unsigned char *data0,
+                                        unsigned char *data1,
+                                        unsigned char *data2,
+                                        unsigned char *data3,
+                                        unsigned int offset,
+                                        unsigned int length)
+{
+  const unsigned char *s0 = (const unsigned char *)state + offset;
+  const unsigned char *s1 = s0 + 1 * STATE_BYTES;
+  const unsigned char *s2 = s0 + 2 * STATE_BYTES;
+  const unsigned char *s3 = s0 + 3 * STATE_BYTES;
+  unsigned int i = 0;
+
+  for (; i + 32 <= length; i += 32)
+  {
+    COPY32(data0 + i, s0 + i);
+    COPY32(data1 + i, s1 + i);
+    COPY32(data2 + i, s2 + i);
+    COPY32(data3 + i, s3 + i);
+  }
+  for (; i + 8 <= length; i += 8)
+  {
+    COPY8(data0 + i, s0 + i);
+    COPY8(data1 + i, s1 + i);
+    COPY8(data2 + i, s2 + i);
+    COPY8(data3 + i, s3 + i);
+  }
+  for (; i < length; i++)
+  {
+    data0[i] = s0[i];
+    data1[i] = s1[i];
+    data2[i] = s2[i];
+    data3[i] = s3[i];
+  }
+}
+
+#else /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP || \
+         MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_keccak_f1600_bytes_avx2 \
+  FIPS202_NAMESPACE(empty_cu_keccak_f1600_bytes_avx2)
+int empty_cu_keccak_f1600_bytes_avx2;
+#endif /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP || \
+          MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
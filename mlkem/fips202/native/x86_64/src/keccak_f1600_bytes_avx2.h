@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef FIPS202_X86_64_BYTES_AVX2_H
+#define FIPS202_X86_64_BYTES_AVX2_H
+
+#include <stdint.h>
+#include "common.h"
+
+#define keccak_f1600_xor_bytes_avx2 FIPS202_NAMESPACE(keccak_f1600_xor_bytes_avx2)
+void keccak_f1600_xor_bytes_avx2(uint64_t *state, const unsigned char *data,
+                                 unsigned int offset, unsigned int length);
+
+#define keccak_f1600_extract_bytes_avx2 \
+  FIPS202_NAMESPACE(keccak_f1600_extract_bytes_avx2)
+void keccak_f1600_extract_bytes_avx2(uint64_t *state, unsigned char *data,
+                                     unsigned int offset, unsigned int length);
+
+#define keccak_f1600_x4_xor_bytes_avx2 \
+  FIPS202_NAMESPACE(keccak_f1600_x4_xor_bytes_avx2)
+void keccak_f1600_x4_xor_bytes_avx2(uint64_t *state,
+                                    const unsigned char *data0,
+                                    const unsigned char *data1,
+                                    const unsigned char *data2,
+                                    const unsigned char *data3,
+                                    unsigned int offset, unsigned int length);
+
+#define keccak_f1600_x4_extract_bytes_avx2 \
+  FIPS202_NAMESPACE(keccak_f1600_x4_extract_bytes_avx2)
+void keccak_f1600_x4_extract_bytes_avx2(uint64_t *state, unsigned char *data0,
+                                        unsigned char *data1,
+                                        unsigned char *data2,
+                                        unsigned char *data3,
+                                        unsigned int offset,
+                                        unsigned int length);
+
+#endif /* FIPS202_X86_64_BYTES_AVX2_H */
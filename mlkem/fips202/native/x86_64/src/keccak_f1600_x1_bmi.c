@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Keccak-f[1600] permutation for x86_64 using BMI1 and BMI2.
+ *
+ * This follows the portable implementation in keccakf1600.c, but the
+ * chi step uses ANDN (BMI1), so that a ^ (~b & c) takes two instructions
+ * instead of three, and rotations are emitted as RORX (BMI2), which does
+ * not overwrite its source and does not touch the flags.
+ *
+ * Lane complementing, as used by XKCP for targets without an and-not
+ * instruction, is not used: with ANDN available, it only adds NOTs.
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP) || \
+    defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512)
+
+#if !defined(__BMI__) || !defined(__BMI2__)
+#error This file must be compiled with BMI1 and BMI2
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "keccak_f1600_x1_bmi.h"
+
+#define KECCAK_X1_NROUNDS 24
+
+static const uint64_t keccak_x1_round_constants[KECCAK_X1_NROUNDS] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+/* Rotation by a constant 0 < n < 64; compiled to RORX */
+#define ROL(a, n) (((a) << (n)) | ((a) >> (64 - (n))))
+
+/* a ^ (~b & c) */
+#define CHI(a, b, c) ((a) ^ _andn_u64((b), (c)))
+
+/* One round of Keccak-f[1600], from state A into state E */
+#define KECCAK_X1_ROUND(A, E, rc)                                          \
+  do                                                                       \
+  {                                                                        \
+    Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa;                            \
+    Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se;                            \
+    Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si;                            \
+    Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so;                            \
+    Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su;                            \
+    Da = Cu ^ ROL(Ce, 1);                                                  \
+    De = Ca ^ ROL(Ci, 1);                                                  \
+    Di = Ce ^ ROL(Co, 1);                                                  \
+    Do = Ci ^ ROL(Cu, 1);                                                  \
+    Du = Co ^ ROL(Ca, 1);                                                  \
+    Ba = A##ba ^ Da;                                                       \
+    Be = ROL(A##ge ^ De, 44);                                              \
+    Bi = ROL(A##ki ^ Di, 43);                                              \
+    Bo = ROL(A##mo ^ Do, 21);                                              \
+    Bu = ROL(A##su ^ Du, 14);                                              \
+    E##ba = CHI(Ba, Be, Bi);                                               \
+    E##be = CHI(Be, Bi, Bo);                                               \
+    E##bi = CHI(Bi, Bo, Bu);                                               \
+    E##bo = CHI(Bo, Bu, Ba);                                               \
+    E##bu = CHI(Bu, Ba, Be);                                               \
+    E##ba ^= (rc);                                                         \
+    Ba = ROL(A##bo ^ Do, 28);                                              \
+    Be = ROL(A##gu ^ Du, 20);                                              \
+    Bi = ROL(A##ka ^ Da, 3);                                               \
+    Bo = ROL(A##me ^ De, 45);                                              \
+    Bu = ROL(A##si ^ Di, 61);                                              \
+    E##ga = CHI(Ba, Be, Bi);                                               \
+    E##ge = CHI(Be, Bi, Bo);                                               \
+    E##gi = CHI(Bi, Bo, Bu);                                               \
+    E##go = CHI(Bo, Bu, Ba);                                               \
+    E##gu = CHI(Bu, Ba, Be);                                               \
+    Ba = ROL(A##be ^ De, 1);                                               \
+    Be = ROL(A##gi ^ Di, 6);                                               \
+    Bi = ROL(A##ko ^ Do, 25);                                              \
+    Bo = ROL(A##mu ^ Du, 8);                                               \
+    Bu = ROL(A##sa ^ Da, 18);                                              \
+    E##ka = CHI(Ba, Be, Bi);                                               \
+    E##ke = CHI(Be, Bi, Bo);                                               \
+    E##ki = CHI(Bi, Bo, Bu);                                               \
+    E##ko = CHI(Bo, Bu, Ba);                                               \
+    E##ku = CHI(Bu, Ba, Be);                                               \
+    Ba = ROL(A##bu ^ Du, 27);                                              \
+    Be = ROL(A##ga ^ Da, 36);                                              \
+    Bi = ROL(A##ke ^ De, 10);                                              \
+    Bo = ROL(A##mi ^ Di, 15);                                              \
+    Bu = ROL(A##so ^ Do, 56);                                              \
+    E##ma = CHI(Ba, Be, Bi);                                               \
+    E##me = CHI(Be, Bi, Bo);                                               \
+    E##mi = CHI(Bi, Bo, Bu);                                               \
+    E##mo = CHI(Bo, Bu, Ba);                                               \
+    E##mu = CHI(Bu, Ba, Be);                                               \
+    Ba = ROL(A##bi ^ Di, 62);                                              \
+    Be = ROL(A##go ^ Do, 55);                                              \
+    Bi = ROL(A##ku ^ Du, 39);                                              \
+    Bo = ROL(A##ma ^ Da, 41);                                              \
+    Bu = ROL(A##se ^ De, 2);                                               \
+    E##sa = CHI(Ba, Be, Bi);                                               \
+    E##se = CHI(Be, Bi, Bo);                                               \
+    E##si = CHI(Bi, Bo, Bu);                                               \
+    E##so = CHI(Bo, Bu, Ba);                                               \
+    E##su = CHI(Bu, Ba, Be);                                               \
+  } while (0)
+
+void keccak_f1600_x1_bmi(uint64_t *state)
+{
+  uint64_t Aba, Abe, Abi, Abo, Abu;
+  uint64_t Aga, Age, Agi, Ago, Agu;
+  uint64_t Aka, Ake, Aki, Ako, Aku;
+  uint64_t Ama, Ame, Ami, Amo, Amu;
+  uint64_t Asa, Ase, Asi, Aso, Asu;
+  uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
+  uint64_t Ega, Ege, Egi, Ego, Egu;
+  uint64_t Eka, Eke, Eki, Eko, Eku;
+  uint64_t Ema, Eme, Emi, Emo, Emu;
+  uint64_t Esa, Ese, Esi, Eso, Esu;
+  uint64_t Ca, Ce, Ci, Co, Cu;
+  uint64_t Da, De, Di, Do, Du;
+  uint64_t Ba, Be, Bi, Bo, Bu;
+  unsigned int round;
+
+  Aba = state[0];
+  Abe = state[1];
+  Abi = state[2];
+  Abo = state[3];
+  Abu = state[4];
+  Aga = state[5];
+  Age = state[6];
+  Agi = state[7];
+  Ago = state[8];
+  Agu = state[9];
+  Aka = state[10];
+  Ake = state[11];
+  Aki = state[12];
+  Ako = state[13];
+  Aku = state[14];
+  Ama = state[15];
+  Ame = state[16];
+  Ami = state[17];
+  Amo = state[18];
+  Amu = state[19];
+  Asa = state[20];
+  Ase = state[21];
+  Asi = state[22];
+  Aso = state[23];
+  Asu = state[24];
+
+  for (round = 0; round < KECCAK_X1_NROUNDS; round += 2)
+  {
+    KECCAK_X1_ROUND(A, E, keccak_x1_round_constants[round]);
+    KECCAK_X1_ROUND(E, A, keccak_x1_round_constants[round + 1]);
+  }
+
+  state[0] = Aba;
+  state[1] = Abe;
+  state[2] = Abi;
+  state[3] = Abo;
+  state[4] = Abu;
+  state[5] = Aga;
+  state[6] = Age;
+  state[7] = Agi;
+  state[8] = Ago;
+  state[9] = Agu;
+  state[10] = Aka;
+  state[11] = Ake;
+  state[12] = Aki;
+  state[13] = Ako;
+  state[14] = Aku;
+  state[15] = Ama;
+  state[16] = Ame;
+  state[17] = Ami;
+  state[18] = Amo;
+  state[19] = Amu;
+  state[20] = Asa;
+  state[21] = Ase;
+  state[22] = Asi;
+  state[23] = Aso;
+  state[24] = Asu;
+}
+
+#else /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP || \
+         MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_keccak_f1600_x1_bmi \
+  FIPS202_NAMESPACE(empty_cu_keccak_f1600_x1_bmi)
+int empty_cu_keccak_f1600_x1_bmi;
+#endif /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_XKCP || \
+          MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
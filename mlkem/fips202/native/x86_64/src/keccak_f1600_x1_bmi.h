@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef FIPS202_X86_64_BMI_NATIVE_H
+#define FIPS202_X86_64_BMI_NATIVE_H
+
+#include <stdint.h>
+#include "common.h"
+
+#define keccak_f1600_x1_bmi FIPS202_NAMESPACE(keccak_f1600_x1_bmi)
+void keccak_f1600_x1_bmi(uint64_t *state);
+
+#endif /* FIPS202_X86_64_BMI_NATIVE_H */
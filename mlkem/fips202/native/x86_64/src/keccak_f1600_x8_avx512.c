@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * 8-fold Keccak-f[1600] permutation using AVX-512.
+ *
+ * Each lane of the eight Keccak states is held in one ZMM register, so
+ * the permutation runs without spilling. Rotations use VPROLQ, and the
+ * XOR5 of theta and the chi step use VPTERNLOGQ.
+ *
+ * The eight states are stored one after the other in memory, as for the
+ * 4-fold Keccak state, and are gathered into / scattered from registers
+ * at the beginning and the end of the permutation.
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512)
+
+#if !defined(__AVX512F__)
+#error This file must be compiled with AVX512F
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "keccak_f1600_x8_avx512.h"
+
+#define KECCAK_X8_NROUNDS 24
+
+static const uint64_t keccak_x8_round_constants[KECCAK_X8_NROUNDS] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+/* a ^ b ^ c ^ d ^ e */
+#define XOR5(a, b, c, d, e) \
+  _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(a, b, c, 0x96), d, e, 0x96)
+
+/* a ^ (~b & c) */
+#define CHI(a, b, c) _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+
+/* One round of Keccak-f[1600], from state A into state E */
+#define KECCAK_X8_ROUND(A, E, rc)                                         \
+  do                                                                      \
+  {                                                                       \
+    Ca = XOR5(A##ba, A##ga, A##ka, A##ma, A##sa);                         \
+    Ce = XOR5(A##be, A##ge, A##ke, A##me, A##se);                         \
+    Ci = XOR5(A##bi, A##gi, A##ki, A##mi, A##si);                         \
+    Co = XOR5(A##bo, A##go, A##ko, A##mo, A##so);                         \
+    Cu = XOR5(A##bu, A##gu, A##ku, A##mu, A##su);                         \
+    Da = _mm512_xor_si512(Cu, _mm512_rol_epi64(Ce, 1));                   \
+    De = _mm512_xor_si512(Ca, _mm512_rol_epi64(Ci, 1));                   \
+    Di = _mm512_xor_si512(Ce, _mm512_rol_epi64(Co, 1));                   \
+    Do = _mm512_xor_si512(Ci, _mm512_rol_epi64(Cu, 1));                   \
+    Du = _mm512_xor_si512(Co, _mm512_rol_epi64(Ca, 1));                   \
+    Ba = _mm512_xor_si512(A##ba, Da);                                     \
+    Be = _mm512_rol_epi64(_mm512_xor_si512(A##ge, De), 44);               \
+    Bi = _mm512_rol_epi64(_mm512_xor_si512(A##ki, Di), 43);               \
+    Bo = _mm512_rol_epi64(_mm512_xor_si512(A##mo, Do), 21);               \
+    Bu = _mm512_rol_epi64(_mm512_xor_si512(A##su, Du), 14);               \
+    E##ba = CHI(Ba, Be, Bi);                                              \
+    E##be = CHI(Be, Bi, Bo);                                              \
+    E##bi = CHI(Bi, Bo, Bu);                                              \
+    E##bo = CHI(Bo, Bu, Ba);                                              \
+    E##bu = CHI(Bu, Ba, Be);                                              \
+    E##ba = _mm512_xor_si512(E##ba, _mm512_set1_epi64((long long)(rc)));  \
+    Ba = _mm512_rol_epi64(_mm512_xor_si512(A##bo, Do), 28);               \
+    Be = _mm512_rol_epi64(_mm512_xor_si512(A##gu, Du), 20);               \
+    Bi = _mm512_rol_epi64(_mm512_xor_si512(A##ka, Da), 3);                \
+    Bo = _mm512_rol_epi64(_mm512_xor_si512(A##me, De), 45);               \
+    Bu = _mm512_rol_epi64(_mm512_xor_si512(A##si, Di), 61);               \
+    E##ga = CHI(Ba, Be, Bi);                                              \
+    E##ge = CHI(Be, Bi, Bo);                                              \
+    E##gi = CHI(Bi, Bo, Bu);                                              \
+    E##go = CHI(Bo, Bu, Ba);                                              \
+    E##gu = CHI(Bu, Ba, Be);                                              \
+    Ba = _mm512_rol_epi64(_mm512_xor_si512(A##be, De), 1);                \
+    Be = _mm512_rol_epi64(_mm512_xor_si512(A##gi, Di), 6);                \
+    Bi = _mm512_rol_epi64(_mm512_xor_si512(A##ko, Do), 25);               \
+    Bo = _mm512_rol_epi64(_mm512_xor_si512(A##mu, Du), 8);                \
+    Bu = _mm512_rol_epi64(_mm512_xor_si512(A##sa, Da), 18);               \
+    E##ka = CHI(Ba, Be, Bi);                                              \
+    E##ke = CHI(Be, Bi, Bo);                                              \
+    E##ki = CHI(Bi, Bo, Bu);                                              \
+    E##ko = CHI(Bo, Bu, Ba);                                              \
+    E##ku = CHI(Bu, Ba, Be);                                              \
+    Ba = _mm512_rol_epi64(_mm512_xor_si512(A##bu, Du), 27);               \
+    Be = _mm512_rol_epi64(_mm512_xor_si512(A##ga, Da), 36);               \
+    Bi = _mm512_rol_epi64(_mm512_xor_si512(A##ke, De), 10);               \
+    Bo = _mm512_rol_epi64(_mm512_xor_si512(A##mi, Di), 15);               \
+    Bu = _mm512_rol_epi64(_mm512_xor_si512(A##so, Do), 56);               \
+    E##ma = CHI(Ba, Be, Bi);                                              \
+    E##me = CHI(Be, Bi, Bo);                                              \
+    E##mi = CHI(Bi, Bo, Bu);                                              \
+    E##mo = CHI(Bo, Bu, Ba);                                              \
+    E##mu = CHI(Bu, Ba, Be);                                              \
+    Ba = _mm512_rol_epi64(_mm512_xor_si512(A##bi, Di), 62);               \
+    Be = _mm512_rol_epi64(_mm512_xor_si512(A##go, Do), 55);               \
+    Bi = _mm512_rol_epi64(_mm512_xor_si512(A##ku, Du), 39);               \
+    Bo = _mm512_rol_epi64(_mm512_xor_si512(A##ma, Da), 41);               \
+    Bu = _mm512_rol_epi64(_mm512_xor_si512(A##se, De), 2);                \
+    E##sa = CHI(Ba, Be, Bi);                                              \
+    E##se = CHI(Be, Bi, Bo);                                              \
+    E##si = CHI(Bi, Bo, Bu);                                              \
+    E##so = CHI(Bo, Bu, Ba);                                              \
+    E##su = CHI(Bu, Ba, Be);                                              \
+  } while (0)
+
+void keccak_f1600_x8_avx512(uint64_t *state)
+{
+  __m512i Aba, Abe, Abi, Abo, Abu;
+  __m512i Aga, Age, Agi, Ago, Agu;
+  __m512i Aka, Ake, Aki, Ako, Aku;
+  __m512i Ama, Ame, Ami, Amo, Amu;
+  __m512i Asa, Ase, Asi, Aso, Asu;
+  __m512i Eba, Ebe, Ebi, Ebo, Ebu;
+  __m512i Ega, Ege, Egi, Ego, Egu;
+  __m512i Eka, Eke, Eki, Eko, Eku;
+  __m512i Ema, Eme, Emi, Emo, Emu;
+  __m512i Esa, Ese, Esi, Eso, Esu;
+  __m512i Ca, Ce, Ci, Co, Cu;
+  __m512i Da, De, Di, Do, Du;
+  __m512i Ba, Be, Bi, Bo, Bu;
+  /* Offsets of the eight states, in lanes */
+  const __m512i idx = _mm512_set_epi64(175, 150, 125, 100, 75, 50, 25, 0);
+  unsigned int round;
+
+  Aba = _mm512_i64gather_epi64(idx, (const void *)(state + 0), 8);
+  Abe = _mm512_i64gather_epi64(idx, (const void *)(state + 1), 8);
+  Abi = _mm512_i64gather_epi64(idx, (const void *)(state + 2), 8);
+  Abo = _mm512_i64gather_epi64(idx, (const void *)(state + 3), 8);
+  Abu = _mm512_i64gather_epi64(idx, (const void *)(state + 4), 8);
+  Aga = _mm512_i64gather_epi64(idx, (const void *)(state + 5), 8);
+  Age = _mm512_i64gather_epi64(idx, (const void *)(state + 6), 8);
+  Agi = _mm512_i64gather_epi64(idx, (const void *)(state + 7), 8);
+  Ago = _mm512_i64gather_epi64(idx, (const void *)(state + 8), 8);
+  Agu = _mm512_i64gather_epi64(idx, (const void *)(state + 9), 8);
+  Aka = _mm512_i64gather_epi64(idx, (const void *)(state + 10), 8);
+  Ake = _mm512_i64gather_epi64(idx, (const void *)(state + 11), 8);
+  Aki = _mm512_i64gather_epi64(idx, (const void *)(state + 12), 8);
+  Ako = _mm512_i64gather_epi64(idx, (const void *)(state + 13), 8);
+  Aku = _mm512_i64gather_epi64(idx, (const void *)(state + 14), 8);
+  Ama = _mm512_i64gather_epi64(idx, (const void *)(state + 15), 8);
+  Ame = _mm512_i64gather_epi64(idx, (const void *)(state + 16), 8);
+  Ami = _mm512_i64gather_epi64(idx, (const void *)(state + 17), 8);
+  Amo = _mm512_i64gather_epi64(idx, (const void *)(state + 18), 8);
+  Amu = _mm512_i64gather_epi64(idx, (const void *)(state + 19), 8);
+  Asa = _mm512_i64gather_epi64(idx, (const void *)(state + 20), 8);
+  Ase = _mm512_i64gather_epi64(idx, (const void *)(state + 21), 8);
+  Asi = _mm512_i64gather_epi64(idx, (const void *)(state + 22), 8);
+  Aso = _mm512_i64gather_epi64(idx, (const void *)(state + 23), 8);
+  Asu = _mm512_i64gather_epi64(idx, (const void *)(state + 24), 8);
+
+  for (round = 0; round < KECCAK_X8_NROUNDS; round += 2)
+  {
+    KECCAK_X8_ROUND(A, E, keccak_x8_round_constants[round]);
+    KECCAK_X8_ROUND(E, A, keccak_x8_round_constants[round + 1]);
+  }
+
+  _mm512_i64scatter_epi64((void *)(state + 0), idx, Aba, 8);
+  _mm512_i64scatter_epi64((void *)(state + 1), idx, Abe, 8);
+  _mm512_i64scatter_epi64((void *)(state + 2), idx, Abi, 8);
+  _mm512_i64scatter_epi64((void *)(state + 3), idx, Abo, 8);
+  _mm512_i64scatter_epi64((void *)(state + 4), idx, Abu, 8);
+  _mm512_i64scatter_epi64((void *)(state + 5), idx, Aga, 8);
+  _mm512_i64scatter_epi64((void *)(state + 6), idx, Age, 8);
+  _mm512_i64scatter_epi64((void *)(state + 7), idx, Agi, 8);
+  _mm512_i64scatter_epi64((void *)(state + 8), idx, Ago, 8);
+  _mm512_i64scatter_epi64((void *)(state + 9), idx, Agu, 8);
+  _mm512_i64scatter_epi64((void *)(state + 10), idx, Aka, 8);
+  _mm512_i64scatter_epi64((void *)(state + 11), idx, Ake, 8);
+  _mm512_i64scatter_epi64((void *)(state + 12), idx, Aki, 8);
+  _mm512_i64scatter_epi64((void *)(state + 13), idx, Ako, 8);
+  _mm512_i64scatter_epi64((void *)(state + 14), idx, Aku, 8);
+  _mm512_i64scatter_epi64((void *)(state + 15), idx, Ama, 8);
+  _mm512_i64scatter_epi64((void *)(state + 16), idx, Ame, 8);
+  _mm512_i64scatter_epi64((void *)(state + 17), idx, Ami, 8);
+  _mm512_i64scatter_epi64((void *)(state + 18), idx, Amo, 8);
+  _mm512_i64scatter_epi64((void *)(state + 19), idx, Amu, 8);
+  _mm512_i64scatter_epi64((void *)(state + 20), idx, Asa, 8);
+  _mm512_i64scatter_epi64((void *)(state + 21), idx, Ase, 8);
+  _mm512_i64scatter_epi64((void *)(state + 22), idx, Asi, 8);
+  _mm512_i64scatter_epi64((void *)(state + 23), idx, Aso, 8);
+  _mm512_i64scatter_epi64((void *)(state + 24), idx, Asu, 8);
+}
+
+#else /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_keccak_f1600_x8_avx512 \
+  FIPS202_NAMESPACE(empty_cu_keccak_f1600_x8_avx512)
+int empty_cu_keccak_f1600_x8_avx512;
+#endif /* MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef FIPS202_X86_64_AVX512_NATIVE_H
+#define FIPS202_X86_64_AVX512_NATIVE_H
+
+#include <stdint.h>
+#include "common.h"
+
+#define keccak_f1600_x8_avx512 FIPS202_NAMESPACE(keccak_f1600_x8_avx512)
+void keccak_f1600_x8_avx512(uint64_t *state);
+
+#endif /* FIPS202_X86_64_AVX512_NATIVE_H */
@@ -11,6 +11,14 @@
 #define MLKEM_NATIVE_FIPS202_PROFILE_IMPL_H
 
 #include "KeccakP-1600-times4-SnP.h"
+#include "keccak_f1600_bytes_avx2.h"
+#include "keccak_f1600_x1_bmi.h"
+
+#define MLKEM_USE_FIPS202_X1_NATIVE
+static INLINE void keccak_f1600_x1_native(uint64_t *state)
+{
+  keccak_f1600_x1_bmi(state);
+}
 
 #define MLKEM_USE_FIPS202_X4_NATIVE
 static INLINE void keccak_f1600_x4_native(uint64_t *state)
@@ -18,4 +26,43 @@ static INLINE void keccak_f1600_x4_native(uint64_t *state)
   KeccakP1600times4_PermuteAll_24rounds(state);
 }
 
+/* Word-oriented absorb and squeeze using AVX2 */
+#define MLKEM_USE_FIPS202_XOR_BYTES_NATIVE
+static INLINE void keccak_f1600_xor_bytes_native(uint64_t *state,
+                                                 const unsigned char *data,
+                                                 unsigned int offset,
+                                                 unsigned int length)
+{
+  keccak_f1600_xor_bytes_avx2(state, data, offset, length);
+}
+
+#define MLKEM_USE_FIPS202_EXTRACT_BYTES_NATIVE
+static INLINE void keccak_f1600_extract_bytes_native(uint64_t *state,
+                                                     unsigned char *data,
+                                                     unsigned int offset,
+                                                     unsigned int length)
+{
+  keccak_f1600_extract_bytes_avx2(state, data, offset, length);
+}
+
+#define MLKEM_USE_FIPS202_X4_XOR_BYTES_NATIVE
+static INLINE void keccak_f1600_x4_xor_bytes_native(
+    uint64_t *state, const unsigned char *data0, const unsigned char *data1,
+    const unsigned char *data2, const unsigned char *data3,
+    unsigned int offset, unsigned int length)
+{
+  keccak_f1600_x4_xor_bytes_avx2(state, data0, data1, data2, data3, offset,
+                                 length);
+}
+
+#define MLKEM_USE_FIPS202_X4_EXTRACT_BYTES_NATIVE
+static INLINE void keccak_f1600_x4_extract_bytes_native(
+    uint64_t *state, unsigned char *data0, unsigned char *data1,
+    unsigned char *data2, unsigned char *data3, unsigned int offset,
+    unsigned int length)
+{
+  keccak_f1600_x4_extract_bytes_avx2(state, data0, data1, data2, data3,
+                                     offset, length);
+}
+
 #endif /* MLKEM_NATIVE_FIPS202_PROFILE_IMPL_H */
@@ -14,9 +14,11 @@
 #include "polyvec.h"
 #include "randombytes.h"
 #include "rej_uniform.h"
+#include "sampling.h"
 #include "symmetric.h"
 
 #include "arith_backend.h"
+#include "fips202_backend.h"
 #include "debug/debug.h"
 
 #include "cbmc.h"
@@ -96,45 +98,6 @@ static void unpack_sk(polyvec *sk,
   polyvec_frombytes(sk, packedsk);
 }
 
-/*************************************************
- * Name:        pack_ciphertext
- *
- * Description: Serialize the ciphertext as concatenation of the
- *              compressed and serialized vector of polynomials b
- *              and the compressed and serialized polynomial v
- *
- * Arguments:   uint8_t *r: pointer to the output serialized ciphertext
- *              poly *pk: pointer to the input vector of polynomials b
- *              poly *v: pointer to the input polynomial v
- **************************************************/
-static void pack_ciphertext(uint8_t r[MLKEM_INDCPA_BYTES], polyvec *b, poly *v)
-{
-  polyvec_compress_du(r, b);
-  poly_compress_dv(r + MLKEM_POLYVECCOMPRESSEDBYTES_DU, v);
-}
-
-/*************************************************
- * Name:        unpack_ciphertext
- *
- * Description: De-serialize and decompress ciphertext from a byte array;
- *              approximate inverse of pack_ciphertext
- *
- * Arguments:   - polyvec *b: pointer to the output vector of polynomials b
- *              - poly *v: pointer to the output polynomial v
- *              - const uint8_t *c: pointer to the input serialized ciphertext
- **************************************************/
-static void unpack_ciphertext(polyvec *b, poly *v,
-                              const uint8_t c[MLKEM_INDCPA_BYTES])
-{
-  polyvec_decompress_du(b, c);
-  poly_decompress_dv(v, c + MLKEM_POLYVECCOMPRESSEDBYTES_DU);
-}
-
-#ifndef MLKEM_GEN_MATRIX_NBLOCKS
-#define MLKEM_GEN_MATRIX_NBLOCKS \
-  ((12 * MLKEM_N / 8 * (1 << 12) / MLKEM_Q + XOF_RATE) / XOF_RATE)
-#endif
-
 /*
  * Generate four A matrix entries from a seed, using rejection
  * sampling on the output of a XOF.
@@ -154,43 +117,24 @@ __contract__(
   ensures(array_bound(vec[2].coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1)))
   ensures(array_bound(vec[3].coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1))))
 {
-  /* Temporary buffers for XOF output before rejection sampling */
-  uint8_t buf0[MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE];
-  uint8_t buf1[MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE];
-  uint8_t buf2[MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE];
-  uint8_t buf3[MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE];
-
   /* Tracks the number of coefficients we have already sampled */
   unsigned int ctr[KECCAK_WAY];
   xof_x4_ctx statex;
-  unsigned int buflen;
 
   /* seed is MLKEM_SYMBYTES + 2 bytes long, but padded to MLKEM_SYMBYTES + 16 */
   xof_x4_absorb(&statex, seed[0], seed[1], seed[2], seed[3],
                 MLKEM_SYMBYTES + 2);
 
   /*
-   * Initially, squeeze heuristic number of MLKEM_GEN_MATRIX_NBLOCKS.
-   * This should generate the matrix entries with high probability.
+   * Squeeze + sample one block at a time until we're done. The blocks
+   * are sampled straight from the Keccak state, so there are no squeeze
+   * buffers, and no block is squeezed that isn't needed.
    */
-  xof_x4_squeezeblocks(buf0, buf1, buf2, buf3, MLKEM_GEN_MATRIX_NBLOCKS,
-                       &statex);
-  buflen = MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE;
-  ctr[0] = rej_uniform(vec[0].coeffs, MLKEM_N, 0, buf0, buflen);
-  ctr[1] = rej_uniform(vec[1].coeffs, MLKEM_N, 0, buf1, buflen);
-  ctr[2] = rej_uniform(vec[2].coeffs, MLKEM_N, 0, buf2, buflen);
-  ctr[3] = rej_uniform(vec[3].coeffs, MLKEM_N, 0, buf3, buflen);
-
-  /*
-   * So long as not all matrix entries have been generated, squeeze
-   * one more block a time until we're done.
-   */
-  buflen = XOF_RATE;
+  ctr[0] = ctr[1] = ctr[2] = ctr[3] = 0;
   while (ctr[0] < MLKEM_N || ctr[1] < MLKEM_N || ctr[2] < MLKEM_N ||
          ctr[3] < MLKEM_N)
   __loop__(
-    assigns(ctr, statex, memory_slice(vec, sizeof(poly) * 4), object_whole(buf0),
-       object_whole(buf1), object_whole(buf2), object_whole(buf3))
+    assigns(ctr, statex, memory_slice(vec, sizeof(poly) * 4))
     invariant(ctr[0] <= MLKEM_N && ctr[1] <= MLKEM_N)
     invariant(ctr[2] <= MLKEM_N && ctr[3] <= MLKEM_N)
     invariant(ctr[0] > 0 ==> array_bound(vec[0].coeffs, 0, ctr[0] - 1, 0, (MLKEM_Q - 1)))
@@ -198,16 +142,21 @@ __contract__(
     invariant(ctr[2] > 0 ==> array_bound(vec[2].coeffs, 0, ctr[2] - 1, 0, (MLKEM_Q - 1)))
     invariant(ctr[3] > 0 ==> array_bound(vec[3].coeffs, 0, ctr[3] - 1, 0, (MLKEM_Q - 1))))
   {
-    xof_x4_squeezeblocks(buf0, buf1, buf2, buf3, 1, &statex);
-    ctr[0] = rej_uniform(vec[0].coeffs, MLKEM_N, ctr[0], buf0, buflen);
-    ctr[1] = rej_uniform(vec[1].coeffs, MLKEM_N, ctr[1], buf1, buflen);
-    ctr[2] = rej_uniform(vec[2].coeffs, MLKEM_N, ctr[2], buf2, buflen);
-    ctr[3] = rej_uniform(vec[3].coeffs, MLKEM_N, ctr[3], buf3, buflen);
+    xof_x4_permute(&statex);
+    ctr[0] = rej_uniform_keccak(vec[0].coeffs, MLKEM_N, ctr[0],
+                                xof_x4_state(&statex, 0));
+    ctr[1] = rej_uniform_keccak(vec[1].coeffs, MLKEM_N, ctr[1],
+                                xof_x4_state(&statex, 1));
+    ctr[2] = rej_uniform_keccak(vec[2].coeffs, MLKEM_N, ctr[2],
+                                xof_x4_state(&statex, 2));
+    ctr[3] = rej_uniform_keccak(vec[3].coeffs, MLKEM_N, ctr[3],
+                                xof_x4_state(&statex, 3));
   }
 
   xof_x4_release(&statex);
 }
 
+#if !defined(MLKEM_USE_FIPS202_X8_NATIVE)
 /*
  * Generate a single A matrix entry from a seed, using rejection
  * sampling on the output of a XOF.
@@ -221,33 +170,25 @@ __contract__(
   ensures(array_bound(entry->coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1))))
 {
   xof_ctx state;
-  uint8_t buf[MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE];
-  unsigned int ctr, buflen;
+  unsigned int ctr = 0;
 
   xof_absorb(&state, seed, MLKEM_SYMBYTES + 2);
 
-  /* Initially, squeeze + sample heuristic number of MLKEM_GEN_MATRIX_NBLOCKS.
-   */
-  /* This should generate the matrix entry with high probability. */
-  xof_squeezeblocks(buf, MLKEM_GEN_MATRIX_NBLOCKS, &state);
-  buflen = MLKEM_GEN_MATRIX_NBLOCKS * XOF_RATE;
-  ctr = rej_uniform(entry->coeffs, MLKEM_N, 0, buf, buflen);
-
-  /* Squeeze + sample one more block a time until we're done */
-  buflen = XOF_RATE;
+  /* Squeeze + sample one block at a time until we're done */
   while (ctr < MLKEM_N)
   __loop__(
-    assigns(ctr, state, memory_slice(entry, sizeof(poly)), object_whole(buf))
+    assigns(ctr, state, memory_slice(entry, sizeof(poly)))
     invariant(0 <= ctr && ctr <= MLKEM_N)
     invariant(ctr > 0 ==> array_bound(entry->coeffs, 0, ctr - 1,
                                           0, (MLKEM_Q - 1))))
   {
-    xof_squeezeblocks(buf, 1, &state);
-    ctr = rej_uniform(entry->coeffs, MLKEM_N, ctr, buf, buflen);
+    xof_permute(&state);
+    ctr = rej_uniform_keccak(entry->coeffs, MLKEM_N, ctr, xof_state(&state));
   }
 
   xof_release(&state);
 }
+#endif /* !MLKEM_USE_FIPS202_X8_NATIVE */
 
 #if !defined(MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER)
 STATIC_INLINE_TESTABLE
@@ -261,8 +202,82 @@ __contract__(
   ensures(array_bound(data->coeffs, 0, MLKEM_N - 1, 0, MLKEM_Q - 1))) { ((void)data); }
 #endif /* MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER */
 
+/*
+ * Fill in the jobs generating row i of the public matrix A (or of its
+ * transpose) for sample_jobs(). Returns the number of jobs, MLKEM_K.
+ */
+static unsigned int gen_matrix_row_jobs(sample_job *jobs, polyvec *row,
+                                        const uint8_t seed[MLKEM_SYMBYTES],
+                                        unsigned int i, int transposed)
+{
+  unsigned int j;
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    if (transposed)
+    {
+      sample_job_uniform(&jobs[j], &row->vec[j], seed, i, j);
+    }
+    else
+    {
+      sample_job_uniform(&jobs[j], &row->vec[j], seed, j, i);
+    }
+  }
+  return MLKEM_K;
+}
+
+/* Permute a row generated via gen_matrix_row_jobs() into the custom order */
+static void gen_matrix_row_finish(polyvec *row)
+{
+  unsigned int j;
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    poly_permute_bitrev_to_custom(&row->vec[j]);
+  }
+}
+
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE) || \
+    !defined(MLKEM_NATIVE_LOW_MEMORY)
+/*
+ * Fill in the jobs generating the public matrix A (or its transpose)
+ * for sample_jobs(). Returns the number of jobs, MLKEM_K * MLKEM_K.
+ */
+static unsigned int gen_matrix_jobs(sample_job *jobs, polyvec *a,
+                                    const uint8_t seed[MLKEM_SYMBYTES],
+                                    int transposed)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    gen_matrix_row_jobs(jobs + i * MLKEM_K, &a[i], seed, i, transposed);
+  }
+  return MLKEM_K * MLKEM_K;
+}
+
+/* Permute matrix generated via gen_matrix_jobs() into the custom order */
+static void gen_matrix_finish(polyvec *a)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    gen_matrix_row_finish(&a[i]);
+  }
+}
+#endif /* MLKEM_USE_FIPS202_X8_NATIVE || !MLKEM_NATIVE_LOW_MEMORY */
+
 /* Not static for benchmarking */
 void gen_matrix(polyvec *a, const uint8_t seed[MLKEM_SYMBYTES], int transposed)
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE)
+{
+  /*
+   * With a native 8-fold Keccak, all entries of A are sampled by the job
+   * scheduler on a single 8-fold state: two passes for MLKEM_K = 3, 4,
+   * with lanes refilled as soon as their entry is complete.
+   */
+  sample_job jobs[MLKEM_K * MLKEM_K];
+  sample_jobs(jobs, gen_matrix_jobs(jobs, a, seed, transposed));
+  gen_matrix_finish(a);
+}
+#else  /* MLKEM_USE_FIPS202_X8_NATIVE */
 {
   int i;
   unsigned int j;
@@ -352,6 +367,27 @@ void gen_matrix(polyvec *a, const uint8_t seed[MLKEM_SYMBYTES], int transposed)
     }
   }
 }
+#endif /* !MLKEM_USE_FIPS202_X8_NATIVE */
+
+/*
+ * Fill in the jobs sampling the noise for indcpa_enc(). Returns the number
+ * of jobs, 2 * MLKEM_K + 1.
+ */
+static unsigned int enc_noise_jobs(sample_job *jobs, polyvec *sp, polyvec *ep,
+                                   poly *epp,
+                                   const uint8_t coins[MLKEM_SYMBYTES])
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    sample_job_cbd(&jobs[i], &sp->vec[i], coins, i, SAMPLE_JOB_CBD_ETA1);
+    sample_job_cbd(&jobs[MLKEM_K + i], &ep->vec[i], coins, MLKEM_K + i,
+                   SAMPLE_JOB_CBD_ETA2);
+  }
+  sample_job_cbd(&jobs[2 * MLKEM_K], epp, coins, 2 * MLKEM_K,
+                 SAMPLE_JOB_CBD_ETA2);
+  return 2 * MLKEM_K + 1;
+}
 
 /*************************************************
  * Name:        matvec_mul
@@ -391,17 +427,61 @@ __contract__(
 
 
 
-STATIC_ASSERT(NTT_BOUND + MLKEM_Q < INT16_MAX, indcpa_enc_bound_0)
+#if defined(MLKEM_NATIVE_LOW_MEMORY)
+/* The matrix is generated on the fly, see matvec_mul_stream() */
+#define INDCPA_MATRIX_JOBS 0
+#else
+#define INDCPA_MATRIX_JOBS (MLKEM_K * MLKEM_K)
+#endif
 
-void indcpa_keypair_derand(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
-                           uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
-                           const uint8_t coins[MLKEM_SYMBYTES])
+#if defined(MLKEM_NATIVE_LOW_MEMORY)
+/*************************************************
+ * Name:        matvec_mul_stream
+ *
+ * Description: Computes the product of the matrix A (or A^T) generated
+ *              from seed with a vector, in NTT domain, via Montgomery
+ *              multiplication. Generates A one row at a time and
+ *              accumulates each row into the output right away, so that
+ *              only a single row is held in memory.
+ *
+ * Arguments:   - polyvec *out: Pointer to output polynomial vector
+ *              - const uint8_t *seed: Seed for the matrix A
+ *              - int transposed: Whether to use A^T rather than A
+ *              - polyvec *v: Input polynomial vector. Must be in NTT domain.
+ *              - polyvec *vc: Mulcache for v, computed via
+ *                  polyvec_mulcache_compute().
+ **************************************************/
+static void matvec_mul_stream(polyvec *out, const uint8_t seed[MLKEM_SYMBYTES],
+                              int transposed, const polyvec *v,
+                              const polyvec_mulcache *vc)
+{
+  polyvec row;
+  sample_job jobs[MLKEM_K];
+  unsigned int i;
+
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    sample_jobs(jobs, gen_matrix_row_jobs(jobs, &row, seed, i, transposed));
+    gen_matrix_row_finish(&row);
+    polyvec_basemul_acc_montgomery_cached(&out->vec[i], &row, v, vc);
+  }
+}
+#endif /* MLKEM_NATIVE_LOW_MEMORY */
+
+/* Check that the arithmetic in indcpa_keypair_derand() does not overflow */
+STATIC_ASSERT(NTT_BOUND + MLKEM_Q < INT16_MAX, indcpa_keypair_bound_0)
+
+void indcpa_keypair_derand_ws(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                              uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
+                              const uint8_t coins[MLKEM_SYMBYTES],
+                              indcpa_keypair_workspace *ws)
 {
   ALIGN uint8_t buf[2 * MLKEM_SYMBYTES];
   const uint8_t *publicseed = buf;
   const uint8_t *noiseseed = buf + MLKEM_SYMBYTES;
-  polyvec a[MLKEM_K], e, pkpv, skpv;
-  polyvec_mulcache skpv_cache;
+  sample_job jobs[INDCPA_MATRIX_JOBS + 2 * MLKEM_K];
+  indcpa_keypair_mul_workspace *mul = &ws->u.mul;
+  unsigned int i, njobs;
 
   ALIGN uint8_t coins_with_domain_separator[MLKEM_SYMBYTES + 1];
   /* Concatenate coins with MLKEM_K for domain separation of security levels */
@@ -410,128 +490,448 @@ void indcpa_keypair_derand(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
 
   hash_g(buf, coins_with_domain_separator, MLKEM_SYMBYTES + 1);
 
-  gen_matrix(a, publicseed, 0 /* no transpose */);
-
-#if MLKEM_K == 2
-  poly_getnoise_eta1_4x(skpv.vec + 0, skpv.vec + 1, e.vec + 0, e.vec + 1,
-                        noiseseed, 0, 1, 2, 3);
-#elif MLKEM_K == 3
   /*
-   * Only the first three output buffers are needed.
-   * The laster parameter is a dummy that's overwritten later.
+   * Sample A, s and e in one go. The matrix jobs come first so that
+   * the shorter noise jobs fill up the lanes at the end.
    */
-  poly_getnoise_eta1_4x(skpv.vec + 0, skpv.vec + 1, skpv.vec + 2,
-                        pkpv.vec + 0 /* irrelevant */, noiseseed, 0, 1, 2,
-                        0xFF /* irrelevant */);
-  /* Same here */
-  poly_getnoise_eta1_4x(e.vec + 0, e.vec + 1, e.vec + 2,
-                        pkpv.vec + 0 /* irrelevant */, noiseseed, 3, 4, 5,
-                        0xFF /* irrelevant */);
-#elif MLKEM_K == 4
-  poly_getnoise_eta1_4x(skpv.vec + 0, skpv.vec + 1, skpv.vec + 2, skpv.vec + 3,
-                        noiseseed, 0, 1, 2, 3);
-  poly_getnoise_eta1_4x(e.vec + 0, e.vec + 1, e.vec + 2, e.vec + 3, noiseseed,
-                        4, 5, 6, 7);
+#if defined(MLKEM_NATIVE_LOW_MEMORY)
+  njobs = 0;
+#else
+  njobs = gen_matrix_jobs(jobs, ws->a, publicseed, 0 /* no transpose */);
+#endif
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    sample_job_cbd(&jobs[njobs + i], &ws->skpv.vec[i], noiseseed, i,
+                   SAMPLE_JOB_CBD_ETA1);
+    sample_job_cbd(&jobs[njobs + MLKEM_K + i], &ws->e.vec[i], noiseseed,
+                   MLKEM_K + i, SAMPLE_JOB_CBD_ETA1);
+  }
+  njobs += 2 * MLKEM_K;
+
+  sample_jobs_ws(jobs, njobs, &ws->u.sample);
+#if !defined(MLKEM_NATIVE_LOW_MEMORY)
+  gen_matrix_finish(ws->a);
+#endif
+
+  polyvec_ntt(&ws->skpv);
+  polyvec_ntt(&ws->e);
+
+  polyvec_mulcache_compute(&mul->skpv_cache, &ws->skpv);
+#if defined(MLKEM_NATIVE_LOW_MEMORY)
+  matvec_mul_stream(&mul->pkpv, publicseed, 0 /* no transpose */, &ws->skpv,
+                    &mul->skpv_cache);
+#else
+  matvec_mul(&mul->pkpv, ws->a, &ws->skpv, &mul->skpv_cache);
 #endif
+  polyvec_tomont(&mul->pkpv);
+
+  /* Arithmetic cannot overflow, see indcpa_keypair_bound_0 above */
+  polyvec_add(&mul->pkpv, &ws->e);
+  polyvec_reduce(&mul->pkpv);
+  polyvec_reduce(&ws->skpv);
+
+  pack_sk(sk, &ws->skpv);
+  pack_pk(pk, &mul->pkpv, publicseed);
+}
+
+void indcpa_keypair_derand(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                           uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
+                           const uint8_t coins[MLKEM_SYMBYTES])
+{
+  indcpa_keypair_workspace ws;
+  indcpa_keypair_derand_ws(pk, sk, coins, &ws);
+}
+
+
+void indcpa_pk_expand(indcpa_expanded_pk *epk,
+                      const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES])
+{
+  ALIGN uint8_t seed[MLKEM_SYMBYTES];
+
+  unpack_pk(&epk->pkpv, seed, pk);
+  gen_matrix(epk->at, seed, 1 /* transpose */);
+}
+
+void indcpa_keypair_derand_x4(uint8_t *pk[4], uint8_t *sk[4],
+                              const uint8_t *coins[4])
+{
+  unsigned int i, j, l;
+  ALIGN uint8_t buf[KECCAK_WAY][2 * MLKEM_SYMBYTES];
+  ALIGN uint8_t coins_with_domain_separator[KECCAK_WAY][MLKEM_SYMBYTES + 1];
+  ALIGN uint8_t seed0[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed1[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed2[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed3[MLKEM_SYMBYTES + 2];
+  uint8_t *seedxy[4];
+  const uint8_t *noiseseed[KECCAK_WAY];
+  polyvec skpv[KECCAK_WAY], pkpv[KECCAK_WAY], a_row[KECCAK_WAY];
+  polyvec_mulcache skpv_cache[KECCAK_WAY];
+  poly e[KECCAK_WAY];
+
+  seedxy[0] = seed0;
+  seedxy[1] = seed1;
+  seedxy[2] = seed2;
+  seedxy[3] = seed3;
+
+  /* Concatenate coins with MLKEM_K for domain separation of security levels */
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    memcpy(coins_with_domain_separator[l], coins[l], MLKEM_SYMBYTES);
+    coins_with_domain_separator[l][MLKEM_SYMBYTES] = MLKEM_K;
+  }
+
+  hash_g_x4(buf[0], buf[1], buf[2], buf[3], coins_with_domain_separator[0],
+            coins_with_domain_separator[1], coins_with_domain_separator[2],
+            coins_with_domain_separator[3], MLKEM_SYMBYTES + 1);
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    /* The first half of buf[l] is the public seed */
+    memcpy(seedxy[l], buf[l], MLKEM_SYMBYTES);
+    noiseseed[l] = buf[l] + MLKEM_SYMBYTES;
+  }
 
-  polyvec_ntt(&skpv);
-  polyvec_ntt(&e);
+  /* See indcpa_enc_x4() for the lane assignment of the noise and matrix */
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    poly_getnoise_eta1_4x_seeds(e, noiseseed, j);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      skpv[l].vec[j] = e[l];
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    polyvec_ntt(&skpv[l]);
+    polyvec_mulcache_compute(&skpv_cache[l], &skpv[l]);
+  }
+
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    for (j = 0; j < MLKEM_K; j++)
+    {
+      poly row[KECCAK_WAY];
+      for (l = 0; l < KECCAK_WAY; l++)
+      {
+        seedxy[l][MLKEM_SYMBYTES + 0] = j;
+        seedxy[l][MLKEM_SYMBYTES + 1] = i;
+      }
+
+      gen_matrix_entry_x4(row, seedxy);
+
+      for (l = 0; l < KECCAK_WAY; l++)
+      {
+        poly_permute_bitrev_to_custom(&row[l]);
+        a_row[l].vec[j] = row[l];
+      }
+    }
+
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      polyvec_basemul_acc_montgomery_cached(&pkpv[l].vec[i], &a_row[l],
+                                            &skpv[l], &skpv_cache[l]);
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    polyvec_tomont(&pkpv[l]);
+  }
+
+  /* Arithmetic cannot overflow, see indcpa_keypair_bound_0 above */
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    poly_getnoise_eta1_4x_seeds(e, noiseseed, MLKEM_K + j);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      poly_ntt(&e[l]);
+      poly_add(&pkpv[l].vec[j], &e[l]);
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    polyvec_reduce(&pkpv[l]);
+    polyvec_reduce(&skpv[l]);
 
-  polyvec_mulcache_compute(&skpv_cache, &skpv);
-  matvec_mul(&pkpv, a, &skpv, &skpv_cache);
-  polyvec_tomont(&pkpv);
+    pack_sk(sk[l], &skpv[l]);
+    pack_pk(pk[l], &pkpv[l], buf[l]);
+  }
+}
 
-  /* Arithmetic cannot overflow, see static assertion at the top */
-  polyvec_add(&pkpv, &e);
-  polyvec_reduce(&pkpv);
-  polyvec_reduce(&skpv);
+/*
+ * Shared tail of the encryption functions, taking b = A^T * sp and
+ * v = t^T * sp in NTT domain and the noise polynomials ep and epp
+ * in the workspace.
+ */
+static void indcpa_enc_finish(uint8_t c[MLKEM_INDCPA_BYTES],
+                              const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                              indcpa_enc_core_workspace *ws)
+{
+  indcpa_enc_mul_workspace *mul = &ws->u.mul;
 
-  pack_sk(sk, &skpv);
-  pack_pk(pk, &pkpv, publicseed);
+  poly_frommsg(&mul->u.k, m);
+
+  /*
+   * Compute and pack u = invNTT(b) + ep and v = invNTT(v) + epp + k,
+   * letting the backend fuse the additions, the reduction and the
+   * compression into one pass.
+   */
+  polyvec_invntt_add_compress_du(c, &mul->b, &ws->ep);
+  poly_invntt_add_compress_dv(c + MLKEM_POLYVECCOMPRESSEDBYTES_DU, &mul->v,
+                              &ws->epp, &mul->u.k);
 }
 
+/*
+ * Shared part of indcpa_enc() and indcpa_enc_expanded(), taking the
+ * already sampled noise polynomials sp, ep and epp in the workspace.
+ */
+static void indcpa_enc_core(uint8_t c[MLKEM_INDCPA_BYTES],
+                            const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                            const polyvec at[MLKEM_K], const polyvec *pkpv,
+                            indcpa_enc_core_workspace *ws)
+{
+  indcpa_enc_mul_workspace *mul = &ws->u.mul;
+
+  polyvec_ntt(&ws->sp);
+
+  polyvec_mulcache_compute(&mul->u.sp_cache, &ws->sp);
+  matvec_mul(&mul->b, at, &ws->sp, &mul->u.sp_cache);
+  polyvec_basemul_acc_montgomery_cached(&mul->v, pkpv, &ws->sp,
+                                        &mul->u.sp_cache);
+
+  indcpa_enc_finish(c, m, ws);
+}
+
+void indcpa_enc_expanded(uint8_t c[MLKEM_INDCPA_BYTES],
+                         const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[MLKEM_SYMBYTES])
+{
+  indcpa_enc_core_workspace ws;
+  sample_job jobs[2 * MLKEM_K + 1];
 
-/* Check that the arithmetic in indcpa_enc() does not overflow */
-STATIC_ASSERT(INVNTT_BOUND + MLKEM_ETA1 < INT16_MAX, indcpa_enc_bound_0)
-STATIC_ASSERT(INVNTT_BOUND + MLKEM_ETA2 + MLKEM_Q < INT16_MAX,
-              indcpa_enc_bound_1)
+  sample_jobs_ws(jobs, enc_noise_jobs(jobs, &ws.sp, &ws.ep, &ws.epp, coins),
+                 &ws.u.sample);
+  indcpa_enc_core(c, m, epk->at, &epk->pkpv, &ws);
+}
+
+void indcpa_enc_ws(uint8_t c[MLKEM_INDCPA_BYTES],
+                   const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                   const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                   const uint8_t coins[MLKEM_SYMBYTES],
+                   indcpa_enc_workspace *ws)
+#if defined(MLKEM_NATIVE_LOW_MEMORY)
+{
+  const uint8_t *seed = pk + MLKEM_POLYVECBYTES;
+  sample_job jobs[2 * MLKEM_K + 1];
+
+  indcpa_enc_core_workspace *core = &ws->core;
+  indcpa_enc_mul_workspace *mul = &core->u.mul;
+
+  sample_jobs_ws(
+      jobs, enc_noise_jobs(jobs, &core->sp, &core->ep, &core->epp, coins),
+      &core->u.sample);
+  /* Only unpack t now, since sample_jobs_ws() may write anywhere in the
+   * object holding its outputs, that is, the workspace */
+  polyvec_frombytes(&ws->pkpv, pk);
+
+  polyvec_ntt(&core->sp);
+
+  polyvec_mulcache_compute(&mul->u.sp_cache, &core->sp);
+  matvec_mul_stream(&mul->b, seed, 1 /* transpose */, &core->sp,
+                    &mul->u.sp_cache);
+  polyvec_basemul_acc_montgomery_cached(&mul->v, &ws->pkpv, &core->sp,
+                                        &mul->u.sp_cache);
+
+  indcpa_enc_finish(c, m, core);
+}
+#else  /* MLKEM_NATIVE_LOW_MEMORY */
+{
+  const uint8_t *seed = pk + MLKEM_POLYVECBYTES;
+  sample_job jobs[SAMPLE_JOBS_MAX];
+  unsigned int njobs;
+
+  /*
+   * Sample A^T and the noise in one go, rather than going through
+   * indcpa_pk_expand(). Matrix jobs come first, see sample_jobs().
+   */
+  njobs = gen_matrix_jobs(jobs, ws->at, seed, 1 /* transpose */);
+  njobs += enc_noise_jobs(jobs + njobs, &ws->core.sp, &ws->core.ep,
+                          &ws->core.epp, coins);
+
+  sample_jobs_ws(jobs, njobs, &ws->core.u.sample);
+  gen_matrix_finish(ws->at);
+  /* Only unpack t now, since sample_jobs_ws() may write anywhere in the
+   * object holding its outputs, that is, the workspace */
+  polyvec_frombytes(&ws->pkpv, pk);
+
+  indcpa_enc_core(c, m, ws->at, &ws->pkpv, &ws->core);
+}
+#endif /* !MLKEM_NATIVE_LOW_MEMORY */
 
 void indcpa_enc(uint8_t c[MLKEM_INDCPA_BYTES],
                 const uint8_t m[MLKEM_INDCPA_MSGBYTES],
                 const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
                 const uint8_t coins[MLKEM_SYMBYTES])
 {
-  ALIGN uint8_t seed[MLKEM_SYMBYTES];
-  polyvec sp, pkpv, ep, at[MLKEM_K], b;
-  poly v, k, epp;
-  polyvec_mulcache sp_cache;
-
-  unpack_pk(&pkpv, seed, pk);
-  poly_frommsg(&k, m);
-  gen_matrix(at, seed, 1 /* transpose */);
-
-#if MLKEM_K == 2
-  poly_getnoise_eta1122_4x(sp.vec + 0, sp.vec + 1, ep.vec + 0, ep.vec + 1,
-                           coins, 0, 1, 2, 3);
-  poly_getnoise_eta2(&epp, coins, 4);
-#elif MLKEM_K == 3
+  indcpa_enc_workspace ws;
+  indcpa_enc_ws(c, m, pk, coins, &ws);
+}
+
+void indcpa_enc_x4(uint8_t *c[4], const uint8_t *m[4], const uint8_t *pk[4],
+                   const uint8_t *coins[4])
+{
+  unsigned int i, j, l;
+  ALIGN uint8_t seed0[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed1[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed2[MLKEM_SYMBYTES + 2];
+  ALIGN uint8_t seed3[MLKEM_SYMBYTES + 2];
+  uint8_t *seedxy[4];
+  polyvec sp[KECCAK_WAY], b[KECCAK_WAY], at_row[KECCAK_WAY];
+  polyvec_mulcache sp_cache[KECCAK_WAY];
+  poly e[KECCAK_WAY], v, k;
+
+  seedxy[0] = seed0;
+  seedxy[1] = seed1;
+  seedxy[2] = seed2;
+  seedxy[3] = seed3;
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    memcpy(seedxy[l], pk[l] + MLKEM_POLYVECBYTES, MLKEM_SYMBYTES);
+  }
+
   /*
-   * In this call, only the first three output buffers are needed.
-   * The last parameter is a dummy that's overwritten later.
+   * Noise polynomials are sampled one nonce at a time, with the four
+   * lanes of each PRF call covering the four encryptions.
    */
-  poly_getnoise_eta1_4x(sp.vec + 0, sp.vec + 1, sp.vec + 2, &b.vec[0], coins, 0,
-                        1, 2, 0xFF);
-  /* The fourth output buffer in this call _is_ used. */
-  poly_getnoise_eta2_4x(ep.vec + 0, ep.vec + 1, ep.vec + 2, &epp, coins, 3, 4,
-                        5, 6);
-#elif MLKEM_K == 4
-  poly_getnoise_eta1_4x(sp.vec + 0, sp.vec + 1, sp.vec + 2, sp.vec + 3, coins,
-                        0, 1, 2, 3);
-  poly_getnoise_eta2_4x(ep.vec + 0, ep.vec + 1, ep.vec + 2, ep.vec + 3, coins,
-                        4, 5, 6, 7);
-  poly_getnoise_eta2(&epp, coins, 8);
-#endif
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    poly_getnoise_eta1_4x_seeds(e, coins, j);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      sp[l].vec[j] = e[l];
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    polyvec_ntt(&sp[l]);
+    polyvec_mulcache_compute(&sp_cache[l], &sp[l]);
+  }
+
+  /*
+   * Generate A^T one row at a time, with the four lanes of each XOF
+   * call covering the same entry of the four matrices, and consume each
+   * row right away. This avoids holding four full matrices on the stack.
+   */
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    for (j = 0; j < MLKEM_K; j++)
+    {
+      poly row[KECCAK_WAY];
+      for (l = 0; l < KECCAK_WAY; l++)
+      {
+        seedxy[l][MLKEM_SYMBYTES + 0] = i;
+        seedxy[l][MLKEM_SYMBYTES + 1] = j;
+      }
 
-  polyvec_ntt(&sp);
+      gen_matrix_entry_x4(row, seedxy);
 
-  polyvec_mulcache_compute(&sp_cache, &sp);
-  matvec_mul(&b, at, &sp, &sp_cache);
-  polyvec_basemul_acc_montgomery_cached(&v, &pkpv, &sp, &sp_cache);
+      for (l = 0; l < KECCAK_WAY; l++)
+      {
+        poly_permute_bitrev_to_custom(&row[l]);
+        at_row[l].vec[j] = row[l];
+      }
+    }
 
-  polyvec_invntt_tomont(&b);
-  poly_invntt_tomont(&v);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      polyvec_basemul_acc_montgomery_cached(&b[l].vec[i], &at_row[l], &sp[l],
+                                            &sp_cache[l]);
+    }
+  }
 
-  /* Arithmetic cannot overflow, see static assertion at the top */
-  polyvec_add(&b, &ep);
-  poly_add(&v, &epp);
-  poly_add(&v, &k);
+  /* Compute and pack u = invNTT(b) + ep, one component at a time */
+  for (j = 0; j < MLKEM_K; j++)
+  {
+    poly_getnoise_eta2_4x_seeds(e, coins, MLKEM_K + j);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      poly_invntt_add_compress_du(c[l] + j * MLKEM_POLYCOMPRESSEDBYTES_DU,
+                                  &b[l].vec[j], &e[l]);
+    }
+  }
 
-  polyvec_reduce(&b);
-  poly_reduce(&v);
+  poly_getnoise_eta2_4x_seeds(e, coins, 2 * MLKEM_K);
 
-  pack_ciphertext(c, &b, &v);
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    /* Re-use at_row[l] for the public-key vector */
+    unpack_pk(&at_row[l], seedxy[l], pk[l]);
+    polyvec_basemul_acc_montgomery_cached(&v, &at_row[l], &sp[l],
+                                          &sp_cache[l]);
+
+    poly_frommsg(&k, m[l]);
+    poly_invntt_add_compress_dv(c[l] + MLKEM_POLYVECCOMPRESSEDBYTES_DU, &v,
+                                &e[l], &k);
+  }
 }
 
 /* Check that the arithmetic in indcpa_dec() does not overflow */
 STATIC_ASSERT(INVNTT_BOUND + MLKEM_Q < INT16_MAX, indcpa_dec_bound_0)
 
-void indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
-                const uint8_t c[MLKEM_INDCPA_BYTES],
-                const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
+void indcpa_sk_expand(indcpa_expanded_sk *esk,
+                      const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
 {
-  polyvec b, skpv;
-  poly v, sb;
+  unpack_sk(&esk->skpv, sk);
+}
+
+/*
+ * Shared part of indcpa_dec_ws() and indcpa_dec_expanded(), using
+ * the workspace for everything but the secret key.
+ */
+static void indcpa_dec_core(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                            const uint8_t c[MLKEM_INDCPA_BYTES],
+                            const indcpa_expanded_sk *esk,
+                            indcpa_dec_core_workspace *ws)
+{
+  polyvec_decompress_du_ntt(&ws->b, c);
+  poly_decompress_dv(&ws->v, c + MLKEM_POLYVECCOMPRESSEDBYTES_DU);
+
+  polyvec_basemul_acc_montgomery(&ws->sb, &esk->skpv, &ws->b);
+  poly_invntt_tomont(&ws->sb);
 
-  unpack_ciphertext(&b, &v, c);
-  unpack_sk(&skpv, sk);
+  /* Arithmetic cannot overflow, see indcpa_dec_bound_0 above */
+  poly_sub(&ws->v, &ws->sb);
+  poly_reduce(&ws->v);
+
+  poly_tomsg(m, &ws->v);
+}
 
-  polyvec_ntt(&b);
-  polyvec_basemul_acc_montgomery(&sb, &skpv, &b);
-  poly_invntt_tomont(&sb);
+void indcpa_dec_expanded(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                         const uint8_t c[MLKEM_INDCPA_BYTES],
+                         const indcpa_expanded_sk *esk)
+{
+  indcpa_dec_core_workspace ws;
+  indcpa_dec_core(m, c, esk, &ws);
+}
 
-  /* Arithmetic cannot overflow, see static assertion at the top */
-  poly_sub(&v, &sb);
-  poly_reduce(&v);
+void indcpa_dec_ws(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                   const uint8_t c[MLKEM_INDCPA_BYTES],
+                   const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
+                   indcpa_dec_workspace *ws)
+{
+  indcpa_sk_expand(&ws->esk, sk);
+  indcpa_dec_core(m, c, &ws->esk, &ws->core);
+}
 
-  poly_tomsg(m, &v);
+void indcpa_dec(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                const uint8_t c[MLKEM_INDCPA_BYTES],
+                const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
+{
+  indcpa_dec_workspace ws;
+  indcpa_dec_ws(m, c, sk, &ws);
 }
@@ -9,6 +9,7 @@
 #include "cbmc.h"
 #include "common.h"
 #include "polyvec.h"
+#include "sampling.h"
 
 #define gen_matrix MLKEM_NAMESPACE(gen_matrix)
 /*************************************************
@@ -33,6 +34,104 @@ __contract__(
   array_bound(a[x].vec[y].coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1)))));
 );
 
+/*
+ * Public key in expanded form, as consumed by indcpa_enc_expanded().
+ *
+ * Both the public-key vector and the transposed matrix A^T are stored
+ * in NTT domain, with the matrix already permuted into the custom
+ * coefficient order used by the arithmetic backend (if any).
+ */
+typedef struct
+{
+  polyvec at[MLKEM_K];
+  polyvec pkpv;
+} indcpa_expanded_pk;
+
+/*
+ * Secret key in expanded form, as consumed by indcpa_dec_expanded().
+ *
+ * The secret-key vector is stored unpacked, in NTT domain.
+ */
+typedef struct
+{
+  polyvec skpv;
+} indcpa_expanded_sk;
+
+/*
+ * Temporaries of indcpa_keypair_derand_ws(), indcpa_enc_ws() and
+ * indcpa_dec_ws(), for callers who want to keep them off the stack.
+ * In MLKEM_NATIVE_LOW_MEMORY mode, the matrix is never held in full
+ * and hence not part of the workspace.
+ *
+ * Temporaries which are only needed once all polynomials have been
+ * sampled share their space with the scratch space of sample_jobs_ws().
+ */
+typedef struct
+{
+  polyvec pkpv;
+  polyvec_mulcache skpv_cache;
+} indcpa_keypair_mul_workspace;
+
+typedef struct
+{
+#if !defined(MLKEM_NATIVE_LOW_MEMORY)
+  polyvec a[MLKEM_K];
+#endif
+  polyvec e, skpv;
+  union
+  {
+    sample_workspace sample;
+    indcpa_keypair_mul_workspace mul;
+  } u;
+} indcpa_keypair_workspace;
+
+typedef struct
+{
+  polyvec b;
+  poly v;
+  /* The message polynomial k is only computed once the mulcache of sp
+   * is no longer needed */
+  union
+  {
+    polyvec_mulcache sp_cache;
+    poly k;
+  } u;
+} indcpa_enc_mul_workspace;
+
+/* Part shared with indcpa_enc_expanded() */
+typedef struct
+{
+  polyvec sp, ep;
+  poly epp;
+  union
+  {
+    sample_workspace sample;
+    indcpa_enc_mul_workspace mul;
+  } u;
+} indcpa_enc_core_workspace;
+
+typedef struct
+{
+#if !defined(MLKEM_NATIVE_LOW_MEMORY)
+  polyvec at[MLKEM_K];
+#endif
+  polyvec pkpv;
+  indcpa_enc_core_workspace core;
+} indcpa_enc_workspace;
+
+/* Part shared with indcpa_dec_expanded() */
+typedef struct
+{
+  polyvec b;
+  poly v, sb;
+} indcpa_dec_core_workspace;
+
+typedef struct
+{
+  indcpa_expanded_sk esk;
+  indcpa_dec_core_workspace core;
+} indcpa_dec_workspace;
+
 #define indcpa_keypair_derand MLKEM_NAMESPACE(indcpa_keypair_derand)
 /*************************************************
  * Name:        indcpa_keypair_derand
@@ -58,6 +157,74 @@ __contract__(
   assigns(object_whole(sk))
 );
 
+#define indcpa_keypair_derand_ws MLKEM_NAMESPACE(indcpa_keypair_derand_ws)
+/*************************************************
+ * Name:        indcpa_keypair_derand_ws
+ *
+ * Description: As indcpa_keypair_derand(), but with the large temporaries
+ *              in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *pk: pointer to output public key
+ *                             (of length MLKEM_INDCPA_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk: pointer to output private key
+ *                             (of length MLKEM_INDCPA_SECRETKEYBYTES bytes)
+ *              - const uint8_t *coins: pointer to input randomness
+ *                             (of length MLKEM_SYMBYTES bytes)
+ *              - indcpa_keypair_workspace *ws: pointer to workspace
+ **************************************************/
+void indcpa_keypair_derand_ws(uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                              uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
+                              const uint8_t coins[MLKEM_SYMBYTES],
+                              indcpa_keypair_workspace *ws)
+__contract__(
+  requires(memory_no_alias(pk, MLKEM_INDCPA_PUBLICKEYBYTES))
+  requires(memory_no_alias(sk, MLKEM_INDCPA_SECRETKEYBYTES))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  requires(memory_no_alias(ws, sizeof(indcpa_keypair_workspace)))
+  assigns(object_whole(pk))
+  assigns(object_whole(sk))
+  assigns(object_whole(ws))
+);
+
+#define indcpa_keypair_derand_x4 MLKEM_NAMESPACE(indcpa_keypair_derand_x4)
+/*************************************************
+ * Name:        indcpa_keypair_derand_x4
+ *
+ * Description: Generates four public and private keys for the CPA-secure
+ *              public-key encryption scheme underlying ML-KEM.
+ *
+ *              Equivalent to four calls to indcpa_keypair_derand(), but
+ *              computes all Keccak instances of the four key generations
+ *              together in the lanes of the x4 Keccak.
+ *
+ * Arguments:   - uint8_t *pk[4]: pointers to output public keys
+ *                             (of length MLKEM_INDCPA_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk[4]: pointers to output private keys
+ *                             (of length MLKEM_INDCPA_SECRETKEYBYTES bytes)
+ *              - const uint8_t *coins[4]: pointers to input randomness
+ *                             (of length MLKEM_SYMBYTES bytes)
+ **************************************************/
+void indcpa_keypair_derand_x4(uint8_t *pk[4], uint8_t *sk[4],
+                              const uint8_t *coins[4])
+/* crypto_kem_keypair_batch() pads a partial group with rows of local
+   arrays, so the lanes are only required to be readable or writeable. */
+__contract__(
+  requires(memory_no_alias(pk, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(sk, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(coins, sizeof(uint8_t *) * 4))
+  requires(forall(int, l, 0, 3, writeable(pk[l], MLKEM_INDCPA_PUBLICKEYBYTES)))
+  requires(forall(int, l, 0, 3, writeable(sk[l], MLKEM_INDCPA_SECRETKEYBYTES)))
+  requires(forall(int, l, 0, 3, readable(coins[l], MLKEM_SYMBYTES)))
+  assigns(memory_slice(pk[0], MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(memory_slice(pk[1], MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(memory_slice(pk[2], MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(memory_slice(pk[3], MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(memory_slice(sk[0], MLKEM_INDCPA_SECRETKEYBYTES))
+  assigns(memory_slice(sk[1], MLKEM_INDCPA_SECRETKEYBYTES))
+  assigns(memory_slice(sk[2], MLKEM_INDCPA_SECRETKEYBYTES))
+  assigns(memory_slice(sk[3], MLKEM_INDCPA_SECRETKEYBYTES))
+);
+
 #define indcpa_enc MLKEM_NAMESPACE(indcpa_enc)
 /*************************************************
  * Name:        indcpa_enc
@@ -86,6 +253,133 @@ __contract__(
   assigns(object_whole(c))
 );
 
+#define indcpa_enc_ws MLKEM_NAMESPACE(indcpa_enc_ws)
+/*************************************************
+ * Name:        indcpa_enc_ws
+ *
+ * Description: As indcpa_enc(), but with the large temporaries
+ *              in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *c: pointer to output ciphertext
+ *                            (of length MLKEM_INDCPA_BYTES bytes)
+ *              - const uint8_t *m: pointer to input message
+ *                                  (of length MLKEM_INDCPA_MSGBYTES bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                                   (of length MLKEM_INDCPA_PUBLICKEYBYTES)
+ *              - const uint8_t *coins: pointer to input random coins used as
+ *seed (of length MLKEM_SYMBYTES) to deterministically generate all randomness
+ *              - indcpa_enc_workspace *ws: pointer to workspace
+ **************************************************/
+void indcpa_enc_ws(uint8_t c[MLKEM_INDCPA_BYTES],
+                   const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                   const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES],
+                   const uint8_t coins[MLKEM_SYMBYTES],
+                   indcpa_enc_workspace *ws)
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(pk, MLKEM_INDCPA_PUBLICKEYBYTES))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  requires(memory_no_alias(ws, sizeof(indcpa_enc_workspace)))
+  assigns(object_whole(c))
+  assigns(object_whole(ws))
+);
+
+#define indcpa_pk_expand MLKEM_NAMESPACE(indcpa_pk_expand)
+/*************************************************
+ * Name:        indcpa_pk_expand
+ *
+ * Description: Unpacks a public key and expands its public seed
+ *              into the transposed matrix A^T, for repeated use
+ *              with indcpa_enc_expanded().
+ *
+ * Arguments:   - indcpa_expanded_pk *epk: pointer to output expanded
+ *                                         public key
+ *              - const uint8_t *pk: pointer to input public key
+ *                                   (of length MLKEM_INDCPA_PUBLICKEYBYTES)
+ **************************************************/
+void indcpa_pk_expand(indcpa_expanded_pk *epk,
+                      const uint8_t pk[MLKEM_INDCPA_PUBLICKEYBYTES])
+__contract__(
+  requires(memory_no_alias(epk, sizeof(indcpa_expanded_pk)))
+  requires(memory_no_alias(pk, MLKEM_INDCPA_PUBLICKEYBYTES))
+  assigns(object_whole(epk))
+  ensures(forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,
+  array_bound(epk->at[x].vec[y].coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1)))));
+);
+
+#define indcpa_enc_expanded MLKEM_NAMESPACE(indcpa_enc_expanded)
+/*************************************************
+ * Name:        indcpa_enc_expanded
+ *
+ * Description: Encryption function of the CPA-secure
+ *              public-key encryption scheme underlying Kyber,
+ *              operating on a public key expanded via indcpa_pk_expand().
+ *
+ * Arguments:   - uint8_t *c: pointer to output ciphertext
+ *                            (of length MLKEM_INDCPA_BYTES bytes)
+ *              - const uint8_t *m: pointer to input message
+ *                                  (of length MLKEM_INDCPA_MSGBYTES bytes)
+ *              - const indcpa_expanded_pk *epk: pointer to input expanded
+ *                                               public key
+ *              - const uint8_t *coins: pointer to input random coins used as
+ *seed (of length MLKEM_SYMBYTES) to deterministically generate all randomness
+ **************************************************/
+void indcpa_enc_expanded(uint8_t c[MLKEM_INDCPA_BYTES],
+                         const uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[MLKEM_SYMBYTES])
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(epk, sizeof(indcpa_expanded_pk)))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  requires(forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,
+  array_abs_bound(epk->at[x].vec[y].coeffs, 0, MLKEM_N - 1, UINT12_MAX))))
+  assigns(object_whole(c))
+);
+
+#define indcpa_enc_x4 MLKEM_NAMESPACE(indcpa_enc_x4)
+/*************************************************
+ * Name:        indcpa_enc_x4
+ *
+ * Description: Four-way batched encryption function of the CPA-secure
+ *              public-key encryption scheme underlying Kyber.
+ *
+ *              Equivalent to four calls to indcpa_enc(), but generates
+ *              matrix entries and noise polynomials for all four
+ *              encryptions together, so that every x4 Keccak call
+ *              has all of its lanes in use.
+ *
+ * Arguments:   - uint8_t *c[4]: pointers to output ciphertexts
+ *                               (of length MLKEM_INDCPA_BYTES bytes)
+ *              - const uint8_t *m[4]: pointers to input messages
+ *                                     (of length MLKEM_INDCPA_MSGBYTES bytes)
+ *              - const uint8_t *pk[4]: pointers to input public keys
+ *                                      (of length MLKEM_INDCPA_PUBLICKEYBYTES)
+ *              - const uint8_t *coins[4]: pointers to input random coins
+ *                                      (of length MLKEM_SYMBYTES)
+ **************************************************/
+void indcpa_enc_x4(uint8_t *c[4], const uint8_t *m[4], const uint8_t *pk[4],
+                   const uint8_t *coins[4])
+/* The buffers of the four lanes may belong to the same object, as in
+   crypto_kem_dec_x4(), so we only require them to be readable or
+   writeable. */
+__contract__(
+  requires(memory_no_alias(c, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(m, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(pk, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(coins, sizeof(uint8_t *) * 4))
+  requires(forall(int, l, 0, 3, writeable(c[l], MLKEM_INDCPA_BYTES)))
+  requires(forall(int, l, 0, 3, readable(m[l], MLKEM_INDCPA_MSGBYTES)))
+  requires(forall(int, l, 0, 3, readable(pk[l], MLKEM_INDCPA_PUBLICKEYBYTES)))
+  requires(forall(int, l, 0, 3, readable(coins[l], MLKEM_SYMBYTES)))
+  assigns(memory_slice(c[0], MLKEM_INDCPA_BYTES))
+  assigns(memory_slice(c[1], MLKEM_INDCPA_BYTES))
+  assigns(memory_slice(c[2], MLKEM_INDCPA_BYTES))
+  assigns(memory_slice(c[3], MLKEM_INDCPA_BYTES))
+);
+
 #define indcpa_dec MLKEM_NAMESPACE(indcpa_dec)
 /*************************************************
  * Name:        indcpa_dec
@@ -110,4 +404,81 @@ __contract__(
   assigns(object_whole(m))
 );
 
+#define indcpa_dec_ws MLKEM_NAMESPACE(indcpa_dec_ws)
+/*************************************************
+ * Name:        indcpa_dec_ws
+ *
+ * Description: As indcpa_dec(), but with the large temporaries
+ *              in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *m: pointer to output decrypted message
+ *                            (of length MLKEM_INDCPA_MSGBYTES)
+ *              - const uint8_t *c: pointer to input ciphertext
+ *                                  (of length MLKEM_INDCPA_BYTES)
+ *              - const uint8_t *sk: pointer to input secret key
+ *                                   (of length MLKEM_INDCPA_SECRETKEYBYTES)
+ *              - indcpa_dec_workspace *ws: pointer to workspace
+ **************************************************/
+void indcpa_dec_ws(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                   const uint8_t c[MLKEM_INDCPA_BYTES],
+                   const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES],
+                   indcpa_dec_workspace *ws)
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(sk, MLKEM_INDCPA_SECRETKEYBYTES))
+  requires(memory_no_alias(ws, sizeof(indcpa_dec_workspace)))
+  assigns(object_whole(m))
+  assigns(object_whole(ws))
+);
+
+#define indcpa_sk_expand MLKEM_NAMESPACE(indcpa_sk_expand)
+/*************************************************
+ * Name:        indcpa_sk_expand
+ *
+ * Description: Unpacks a secret key for repeated use with
+ *              indcpa_dec_expanded().
+ *
+ * Arguments:   - indcpa_expanded_sk *esk: pointer to output expanded
+ *                                         secret key
+ *              - const uint8_t *sk: pointer to input secret key
+ *                                   (of length MLKEM_INDCPA_SECRETKEYBYTES)
+ **************************************************/
+void indcpa_sk_expand(indcpa_expanded_sk *esk,
+                      const uint8_t sk[MLKEM_INDCPA_SECRETKEYBYTES])
+__contract__(
+  requires(memory_no_alias(esk, sizeof(indcpa_expanded_sk)))
+  requires(memory_no_alias(sk, MLKEM_INDCPA_SECRETKEYBYTES))
+  assigns(object_whole(esk))
+  ensures(forall(int, k0, 0, MLKEM_K - 1,
+  array_bound(esk->skpv.vec[k0].coeffs, 0, MLKEM_N - 1, 0, UINT12_MAX)))
+);
+
+#define indcpa_dec_expanded MLKEM_NAMESPACE(indcpa_dec_expanded)
+/*************************************************
+ * Name:        indcpa_dec_expanded
+ *
+ * Description: Decryption function of the CPA-secure
+ *              public-key encryption scheme underlying Kyber,
+ *              operating on a secret key expanded via indcpa_sk_expand().
+ *
+ * Arguments:   - uint8_t *m: pointer to output decrypted message
+ *                            (of length MLKEM_INDCPA_MSGBYTES)
+ *              - const uint8_t *c: pointer to input ciphertext
+ *                                  (of length MLKEM_INDCPA_BYTES)
+ *              - const indcpa_expanded_sk *esk: pointer to input expanded
+ *                                               secret key
+ **************************************************/
+void indcpa_dec_expanded(uint8_t m[MLKEM_INDCPA_MSGBYTES],
+                         const uint8_t c[MLKEM_INDCPA_BYTES],
+                         const indcpa_expanded_sk *esk)
+__contract__(
+  requires(memory_no_alias(c, MLKEM_INDCPA_BYTES))
+  requires(memory_no_alias(m, MLKEM_INDCPA_MSGBYTES))
+  requires(memory_no_alias(esk, sizeof(indcpa_expanded_sk)))
+  requires(forall(int, k0, 0, MLKEM_K - 1,
+  array_abs_bound(esk->skpv.vec[k0].coeffs, 0, MLKEM_N - 1, UINT12_MAX)))
+  assigns(object_whole(m))
+);
+
 #endif
@@ -34,17 +34,12 @@ __contract__(
  **************************************************/
 static int check_pk(const uint8_t pk[MLKEM_PUBLICKEYBYTES])
 {
-  polyvec p;
-  uint8_t p_reencoded[MLKEM_POLYVECBYTES];
-  polyvec_frombytes(&p, pk);
-  polyvec_reduce(&p);
-  polyvec_tobytes(p_reencoded, &p);
-  /* Data is public, so a variable-time memcmp() is OK */
-  if (memcmp(pk, p_reencoded, MLKEM_POLYVECBYTES))
-  {
-    return -1;
-  }
-  return 0;
+  /*
+   * Equivalent to re-encoding the decoded and reduced public key and
+   * comparing it to the original, but checks the packed coefficients
+   * directly.
+   */
+  return polyvec_modulus_check(pk);
 }
 
 /*************************************************
@@ -77,15 +72,35 @@ static int check_sk(const uint8_t sk[MLKEM_SECRETKEYBYTES])
   return 0;
 }
 
-int crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins)
+/*
+ * The API functions below come in pairs: the _ws variant uses the
+ * relevant part of the caller's mlkem_workspace, while the other one
+ * allocates just that part on the stack.
+ */
+
+static void keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins,
+                           indcpa_keypair_workspace *ws)
 {
-  indcpa_keypair_derand(pk, sk, coins);
+  indcpa_keypair_derand_ws(pk, sk, coins, ws);
   memcpy(sk + MLKEM_INDCPA_SECRETKEYBYTES, pk, MLKEM_PUBLICKEYBYTES);
   hash_h(sk + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES, pk,
          MLKEM_PUBLICKEYBYTES);
   /* Value z for pseudo-random output on reject */
   memcpy(sk + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES, coins + MLKEM_SYMBYTES,
          MLKEM_SYMBYTES);
+}
+
+int crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins)
+{
+  indcpa_keypair_workspace ws;
+  keypair_derand(pk, sk, coins, &ws);
+  return 0;
+}
+
+int crypto_kem_keypair_derand_ws(uint8_t *pk, uint8_t *sk,
+                                 const uint8_t *coins, mlkem_workspace *ws)
+{
+  keypair_derand(pk, sk, coins, &ws->keypair);
   return 0;
 }
 
@@ -97,8 +112,307 @@ int crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return 0;
 }
 
-int crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
-                          const uint8_t *coins)
+int crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, mlkem_workspace *ws)
+{
+  ALIGN uint8_t coins[2 * MLKEM_SYMBYTES];
+  randombytes(coins, 2 * MLKEM_SYMBYTES);
+  crypto_kem_keypair_derand_ws(pk, sk, coins, ws);
+  return 0;
+}
+
+/*************************************************
+ * Name:        keypair_x4_derand
+ *
+ * Description: Four-way batched crypto_kem_keypair_derand().
+ *
+ * Arguments:   - uint8_t *pk[4]: pointers to output public keys
+ *              - uint8_t *sk[4]: pointers to output private keys
+ *              - const uint8_t *coins[4]: pointers to input randomness
+ *                (of length 2*MLKEM_SYMBYTES bytes each)
+ **************************************************/
+static void keypair_x4_derand(uint8_t *pk[4], uint8_t *sk[4],
+                              const uint8_t *coins[4])
+{
+  unsigned int l;
+  indcpa_keypair_derand_x4(pk, sk, coins);
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    memcpy(sk[l] + MLKEM_INDCPA_SECRETKEYBYTES, pk[l], MLKEM_PUBLICKEYBYTES);
+  }
+  hash_h_x4(sk[0] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+            sk[1] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+            sk[2] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+            sk[3] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES, pk[0], pk[1],
+            pk[2], pk[3], MLKEM_PUBLICKEYBYTES);
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    /* Value z for pseudo-random output on reject */
+    memcpy(sk[l] + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES,
+           coins[l] + MLKEM_SYMBYTES, MLKEM_SYMBYTES);
+  }
+}
+
+int crypto_kem_keypair_batch(size_t n, uint8_t *pk[], uint8_t *sk[],
+                             const uint8_t *coins[])
+{
+  size_t i, l;
+
+  for (i = 0; i < n; i += KECCAK_WAY)
+  {
+    uint8_t *pk_x4[KECCAK_WAY], *sk_x4[KECCAK_WAY];
+    const uint8_t *coins_x4[KECCAK_WAY];
+    /* A partial group has at least two entries, see below */
+    ALIGN uint8_t pad_pk[KECCAK_WAY - 2][MLKEM_PUBLICKEYBYTES];
+    ALIGN uint8_t pad_sk[KECCAK_WAY - 2][MLKEM_SECRETKEYBYTES];
+    ALIGN uint8_t pad_coins[KECCAK_WAY - 2][2 * MLKEM_SYMBYTES];
+    size_t rem = n - i;
+
+    /* A single leftover key pair is cheaper generated on its own */
+    if (rem == 1)
+    {
+      crypto_kem_keypair_derand(pk[i], sk[i], coins[i]);
+      break;
+    }
+
+    /*
+     * Pad a partial last group by repeating its last entry. Every padding
+     * lane gets its own copy of the coins and its own output buffers, so
+     * that no two lanes alias.
+     */
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      if (l < rem)
+      {
+        pk_x4[l] = pk[i + l];
+        sk_x4[l] = sk[i + l];
+        coins_x4[l] = coins[i + l];
+      }
+      else
+      {
+        memcpy(pad_coins[l - rem], coins[i + rem - 1], 2 * MLKEM_SYMBYTES);
+        pk_x4[l] = pad_pk[l - rem];
+        sk_x4[l] = pad_sk[l - rem];
+        coins_x4[l] = pad_coins[l - rem];
+      }
+    }
+
+    keypair_x4_derand(pk_x4, sk_x4, coins_x4);
+  }
+
+  return 0;
+}
+
+int crypto_kem_pk_expand(mlkem_expanded_pk *epk, const uint8_t *pk)
+{
+  if (check_pk(pk))
+  {
+    return -1;
+  }
+
+  hash_h(epk->hpk, pk, MLKEM_PUBLICKEYBYTES);
+  indcpa_pk_expand(&epk->indcpa, pk);
+  return 0;
+}
+
+int crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss,
+                                   const mlkem_expanded_pk *epk,
+                                   const uint8_t *coins)
+{
+  hash_g_ctx g;
+  /* Will contain key, coins */
+  ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  hash_g_init(&g);
+  hash_g_absorb(&g, coins, MLKEM_SYMBYTES);
+  hash_g_absorb(&g, epk->hpk, MLKEM_SYMBYTES);
+  hash_g_finalize(kr, &g);
+
+  /* coins are in kr+MLKEM_SYMBYTES */
+  indcpa_enc_expanded(ct, coins, &epk->indcpa, kr + MLKEM_SYMBYTES);
+
+  memcpy(ss, kr, MLKEM_SYMBYTES);
+  return 0;
+}
+
+int crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss,
+                            const mlkem_expanded_pk *epk)
+{
+  ALIGN uint8_t coins[MLKEM_SYMBYTES];
+  randombytes(coins, MLKEM_SYMBYTES);
+  return crypto_kem_enc_expanded_derand(ct, ss, epk, coins);
+}
+
+int crypto_kem_pk_cache_init(mlkem_pk_cache *cache,
+                             mlkem_pk_cache_entry *entries, size_t capacity,
+                             mlkem_pk_cache_lock_fn lock,
+                             mlkem_pk_cache_lock_fn unlock, void *lock_arg)
+{
+  size_t i;
+
+  if (capacity == 0 || (lock == NULL) != (unlock == NULL))
+  {
+    return -1;
+  }
+
+  for (i = 0; i < capacity; i++)
+  {
+    entries[i].last_use = 0;
+  }
+
+  cache->entries = entries;
+  cache->capacity = capacity;
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+  cache->lock = lock;
+  cache->unlock = unlock;
+  cache->lock_arg = lock_arg;
+  return 0;
+}
+
+static void pk_cache_lock(mlkem_pk_cache *cache)
+{
+  if (cache->lock != NULL)
+  {
+    cache->lock(cache->lock_arg);
+  }
+}
+
+static void pk_cache_unlock(mlkem_pk_cache *cache)
+{
+  if (cache->unlock != NULL)
+  {
+    cache->unlock(cache->lock_arg);
+  }
+}
+
+int crypto_kem_pk_cache_stats(mlkem_pk_cache *cache, uint64_t *hits,
+                              uint64_t *misses)
+{
+  pk_cache_lock(cache);
+  *hits = cache->hits;
+  *misses = cache->misses;
+  pk_cache_unlock(cache);
+  return 0;
+}
+
+/*************************************************
+ * Name:        pk_cache_lookup
+ *
+ * Description: Looks up the public key with hash hpk in the cache and,
+ *              if present, copies its expanded form to epk.
+ *
+ *              Must be called with the cache locked.
+ *
+ * Returns 1 on a hit, and 0 on a miss
+ **************************************************/
+static int pk_cache_lookup(mlkem_expanded_pk *epk, mlkem_pk_cache *cache,
+                           const uint8_t hpk[MLKEM_SYMBYTES])
+{
+  size_t i;
+  for (i = 0; i < cache->capacity; i++)
+  __loop__(
+    assigns(i, cache->clock, cache->hits, object_whole(epk),
+            memory_slice(cache->entries,
+                         sizeof(mlkem_pk_cache_entry) * cache->capacity))
+    invariant(i <= cache->capacity)
+    invariant(pk_cache_bound(cache)))
+  {
+    mlkem_pk_cache_entry *e = &cache->entries[i];
+    /* H(pk) is public, so there is no need for a constant-time compare */
+    if (e->last_use != 0 && memcmp(e->epk.hpk, hpk, MLKEM_SYMBYTES) == 0)
+    {
+      e->last_use = ++cache->clock;
+      cache->hits++;
+      memcpy(epk, &e->epk, sizeof(mlkem_expanded_pk));
+      return 1;
+    }
+  }
+  cache->misses++;
+  return 0;
+}
+
+/*************************************************
+ * Name:        pk_cache_insert
+ *
+ * Description: Adds an expanded public key to the cache, replacing an
+ *              empty entry or else the least recently used one. Does
+ *              nothing if the key is already present, which happens if
+ *              another thread added it since our lookup.
+ *
+ *              Must be called with the cache locked.
+ **************************************************/
+static void pk_cache_insert(mlkem_pk_cache *cache,
+                            const mlkem_expanded_pk *epk)
+{
+  size_t i, victim = 0;
+  for (i = 0; i < cache->capacity; i++)
+  __loop__(
+    assigns(i, victim)
+    invariant(i <= cache->capacity && victim < cache->capacity))
+  {
+    mlkem_pk_cache_entry *e = &cache->entries[i];
+    if (e->last_use != 0 && memcmp(e->epk.hpk, epk->hpk, MLKEM_SYMBYTES) == 0)
+    {
+      return;
+    }
+    if (e->last_use < cache->entries[victim].last_use)
+    {
+      victim = i;
+    }
+  }
+  memcpy(&cache->entries[victim].epk, epk, sizeof(mlkem_expanded_pk));
+  cache->entries[victim].last_use = ++cache->clock;
+}
+
+int crypto_kem_enc_cached_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                                 mlkem_pk_cache *cache, const uint8_t *coins)
+{
+  int hit;
+  /*
+   * Local copy of the cache entry, so that the cache is only locked
+   * for the lookup and not for the encapsulation
+   */
+  mlkem_expanded_pk epk;
+
+  /*
+   * The cache is keyed by H(pk), which encapsulation needs anyway.
+   * Keying by the address of pk instead would skip this hash, but
+   * would not notice if the contents of pk changed.
+   */
+  hash_h(epk.hpk, pk, MLKEM_PUBLICKEYBYTES);
+
+  pk_cache_lock(cache);
+  hit = pk_cache_lookup(&epk, cache, epk.hpk);
+  pk_cache_unlock(cache);
+
+  if (!hit)
+  {
+    if (check_pk(pk))
+    {
+      return -1;
+    }
+    indcpa_pk_expand(&epk.indcpa, pk);
+
+    pk_cache_lock(cache);
+    pk_cache_insert(cache, &epk);
+    pk_cache_unlock(cache);
+  }
+
+  return crypto_kem_enc_expanded_derand(ct, ss, &epk, coins);
+}
+
+int crypto_kem_enc_cached(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                          mlkem_pk_cache *cache)
+{
+  ALIGN uint8_t coins[MLKEM_SYMBYTES];
+  randombytes(coins, MLKEM_SYMBYTES);
+  return crypto_kem_enc_cached_derand(ct, ss, pk, cache, coins);
+}
+
+static int enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                      const uint8_t *coins, indcpa_enc_workspace *ws)
 {
   ALIGN uint8_t buf[2 * MLKEM_SYMBYTES];
   /* Will contain key, coins */
@@ -115,13 +429,30 @@ int crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
   hash_h(buf + MLKEM_SYMBYTES, pk, MLKEM_PUBLICKEYBYTES);
   hash_g(kr, buf, 2 * MLKEM_SYMBYTES);
 
-  /* coins are in kr+MLKEM_SYMBYTES */
-  indcpa_enc(ct, buf, pk, kr + MLKEM_SYMBYTES);
+  /*
+   * coins are in kr+MLKEM_SYMBYTES. Use indcpa_enc_ws() rather than the
+   * expanded API so that the matrix and the noise share Keccak-f1600x4
+   * permutations.
+   */
+  indcpa_enc_ws(ct, buf, pk, kr + MLKEM_SYMBYTES, ws);
 
   memcpy(ss, kr, MLKEM_SYMBYTES);
   return 0;
 }
 
+int crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                          const uint8_t *coins)
+{
+  indcpa_enc_workspace ws;
+  return enc_derand(ct, ss, pk, coins, &ws);
+}
+
+int crypto_kem_enc_derand_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                             const uint8_t *coins, mlkem_workspace *ws)
+{
+  return enc_derand(ct, ss, pk, coins, &ws->enc);
+}
+
 int crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk)
 {
   ALIGN uint8_t coins[MLKEM_SYMBYTES];
@@ -129,12 +460,71 @@ int crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk)
   return crypto_kem_enc_derand(ct, ss, pk, coins);
 }
 
-int crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
+int crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                      mlkem_workspace *ws)
 {
-  uint8_t fail;
-  ALIGN uint8_t buf[2 * MLKEM_SYMBYTES];
+  ALIGN uint8_t coins[MLKEM_SYMBYTES];
+  randombytes(coins, MLKEM_SYMBYTES);
+  return crypto_kem_enc_derand_ws(ct, ss, pk, coins, ws);
+}
+
+int crypto_kem_enc_x4_derand(uint8_t *ct[4], uint8_t *ss[4],
+                             const uint8_t *pk[4], const uint8_t *coins[4])
+{
+  unsigned int l;
+  ALIGN uint8_t buf[KECCAK_WAY][2 * MLKEM_SYMBYTES];
   /* Will contain key, coins */
-  ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+  ALIGN uint8_t kr[KECCAK_WAY][2 * MLKEM_SYMBYTES];
+  const uint8_t *m[KECCAK_WAY], *kr_coins[KECCAK_WAY];
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    if (check_pk(pk[l]))
+    {
+      return -1;
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    memcpy(buf[l], coins[l], MLKEM_SYMBYTES);
+    m[l] = buf[l];
+    kr_coins[l] = kr[l] + MLKEM_SYMBYTES;
+  }
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  hash_h_x4(buf[0] + MLKEM_SYMBYTES, buf[1] + MLKEM_SYMBYTES,
+            buf[2] + MLKEM_SYMBYTES, buf[3] + MLKEM_SYMBYTES, pk[0], pk[1],
+            pk[2], pk[3], MLKEM_PUBLICKEYBYTES);
+  hash_g_x4(kr[0], kr[1], kr[2], kr[3], buf[0], buf[1], buf[2], buf[3],
+            2 * MLKEM_SYMBYTES);
+
+  /* coins are in kr+MLKEM_SYMBYTES */
+  indcpa_enc_x4(ct, m, pk, kr_coins);
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    memcpy(ss[l], kr[l], MLKEM_SYMBYTES);
+  }
+  return 0;
+}
+
+int crypto_kem_enc_x4(uint8_t *ct[4], uint8_t *ss[4], const uint8_t *pk[4])
+{
+  unsigned int l;
+  ALIGN uint8_t coins[KECCAK_WAY][MLKEM_SYMBYTES];
+  const uint8_t *coins_ptr[KECCAK_WAY];
+
+  randombytes(coins[0], KECCAK_WAY * MLKEM_SYMBYTES);
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    coins_ptr[l] = coins[l];
+  }
+  return crypto_kem_enc_x4_derand(ct, ss, pk, coins_ptr);
+}
+
+int crypto_kem_sk_expand(mlkem_expanded_sk *esk, const uint8_t *sk)
+{
   const uint8_t *pk = sk + MLKEM_INDCPA_SECRETKEYBYTES;
 
   if (check_sk(sk))
@@ -142,33 +532,233 @@ int crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
     return -1;
   }
 
-  indcpa_dec(buf, ct, sk);
+  indcpa_sk_expand(&esk->indcpa, sk);
+  indcpa_pk_expand(&esk->pk.indcpa, pk);
+  memcpy(esk->pk.hpk, sk + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+         MLKEM_SYMBYTES);
+  memcpy(esk->z, sk + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES, MLKEM_SYMBYTES);
+  return 0;
+}
+
+int crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct,
+                            const mlkem_expanded_sk *esk)
+{
+  uint8_t fail;
+  hash_g_ctx g;
+  hash_j_ctx j;
+  ALIGN uint8_t buf[MLKEM_SYMBYTES];
+  /* Will contain key, coins */
+  ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+
+  indcpa_dec_expanded(buf, ct, &esk->indcpa);
 
   /* Multitarget countermeasure for coins + contributory KEM */
-  memcpy(buf + MLKEM_SYMBYTES, sk + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
-         MLKEM_SYMBYTES);
-  hash_g(kr, buf, 2 * MLKEM_SYMBYTES);
+  hash_g_init(&g);
+  hash_g_absorb(&g, buf, MLKEM_SYMBYTES);
+  hash_g_absorb(&g, esk->pk.hpk, MLKEM_SYMBYTES);
+  hash_g_finalize(kr, &g);
 
   /* Recompute and compare ciphertext */
   {
     /* Temporary buffer */
     ALIGN uint8_t cmp[MLKEM_CIPHERTEXTBYTES];
     /* coins are in kr+MLKEM_SYMBYTES */
-    indcpa_enc(cmp, buf, pk, kr + MLKEM_SYMBYTES);
+    indcpa_enc_expanded(cmp, buf, &esk->pk.indcpa, kr + MLKEM_SYMBYTES);
     fail = ct_memcmp(ct, cmp, MLKEM_CIPHERTEXTBYTES);
   }
 
-  /* Compute rejection key */
+  /* Compute rejection key J(z || ct) */
+  hash_j_init(&j);
+  hash_j_absorb(&j, esk->z, MLKEM_SYMBYTES);
+  hash_j_absorb(&j, ct, MLKEM_CIPHERTEXTBYTES);
+  hash_j_finalize(ss, &j);
+
+  /* Copy true key to return buffer if fail is 0 */
+  ct_cmov_zero(ss, kr, MLKEM_SYMBYTES, fail);
+
+  return 0;
+}
+
+/*
+ * As crypto_kem_dec_expanded(), but re-encrypting via indcpa_enc_ws(),
+ * which samples the matrix and the noise in one go
+ */
+static int dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk,
+               mlkem_dec_workspace *ws)
+{
+  uint8_t fail;
+  hash_g_ctx g;
+  hash_j_ctx j;
+  ALIGN uint8_t buf[MLKEM_SYMBYTES];
+  /* Will contain key, coins */
+  ALIGN uint8_t kr[2 * MLKEM_SYMBYTES];
+  const uint8_t *pk = sk + MLKEM_INDCPA_SECRETKEYBYTES;
+
+  if (check_sk(sk))
   {
-    /* Temporary buffer */
-    ALIGN uint8_t tmp[MLKEM_SYMBYTES + MLKEM_CIPHERTEXTBYTES];
-    memcpy(tmp, sk + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES, MLKEM_SYMBYTES);
-    memcpy(tmp + MLKEM_SYMBYTES, ct, MLKEM_CIPHERTEXTBYTES);
-    hash_j(ss, tmp, sizeof(tmp));
+    return -1;
   }
 
+  indcpa_dec_ws(buf, ct, sk, &ws->indcpa.dec);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  hash_g_init(&g);
+  hash_g_absorb(&g, buf, MLKEM_SYMBYTES);
+  hash_g_absorb(&g, sk + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES,
+                MLKEM_SYMBYTES);
+  hash_g_finalize(kr, &g);
+
+  /* Recompute and compare ciphertext; coins are in kr+MLKEM_SYMBYTES */
+  indcpa_enc_ws(ws->cmp, buf, pk, kr + MLKEM_SYMBYTES, &ws->indcpa.enc);
+  fail = ct_memcmp(ct, ws->cmp, MLKEM_CIPHERTEXTBYTES);
+
+  /* Compute rejection key J(z || ct) */
+  hash_j_init(&j);
+  hash_j_absorb(&j, sk + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES,
+                MLKEM_SYMBYTES);
+  hash_j_absorb(&j, ct, MLKEM_CIPHERTEXTBYTES);
+  hash_j_finalize(ss, &j);
+
   /* Copy true key to return buffer if fail is 0 */
   ct_cmov_zero(ss, kr, MLKEM_SYMBYTES, fail);
 
   return 0;
 }
+
+int crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk)
+{
+  mlkem_dec_workspace ws;
+  return dec(ss, ct, sk, &ws);
+}
+
+int crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk,
+                      mlkem_workspace *ws)
+{
+  return dec(ss, ct, sk, &ws->dec);
+}
+
+int crypto_kem_dec_x4(uint8_t *ss[4], const uint8_t *ct[4],
+                      const uint8_t *sk[4])
+{
+  unsigned int l;
+  uint8_t fail[KECCAK_WAY];
+  ALIGN uint8_t buf[KECCAK_WAY][2 * MLKEM_SYMBYTES];
+  /* Will contain key, coins */
+  ALIGN uint8_t kr[KECCAK_WAY][2 * MLKEM_SYMBYTES];
+  ALIGN uint8_t test[KECCAK_WAY][MLKEM_SYMBYTES];
+  const uint8_t *pk[KECCAK_WAY], *m[KECCAK_WAY], *kr_coins[KECCAK_WAY];
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    pk[l] = sk[l] + MLKEM_INDCPA_SECRETKEYBYTES;
+  }
+
+  /*
+   * Four-way batched check_sk(). As there, the data being hashed and
+   * compared is public.
+   */
+  hash_h_x4(test[0], test[1], test[2], test[3], pk[0], pk[1], pk[2], pk[3],
+            MLKEM_PUBLICKEYBYTES);
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    if (memcmp(sk[l] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES, test[l],
+               MLKEM_SYMBYTES))
+    {
+      return -1;
+    }
+  }
+
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    indcpa_dec(buf[l], ct[l], sk[l]);
+
+    /* Multitarget countermeasure for coins + contributory KEM */
+    memcpy(buf[l] + MLKEM_SYMBYTES,
+           sk[l] + MLKEM_SECRETKEYBYTES - 2 * MLKEM_SYMBYTES, MLKEM_SYMBYTES);
+    m[l] = buf[l];
+    kr_coins[l] = kr[l] + MLKEM_SYMBYTES;
+  }
+  hash_g_x4(kr[0], kr[1], kr[2], kr[3], buf[0], buf[1], buf[2], buf[3],
+            2 * MLKEM_SYMBYTES);
+
+  /* Recompute and compare ciphertexts */
+  {
+    /* Temporary buffer */
+    ALIGN uint8_t cmp[KECCAK_WAY][MLKEM_CIPHERTEXTBYTES];
+    uint8_t *cmp_ptr[KECCAK_WAY];
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      cmp_ptr[l] = cmp[l];
+    }
+    /* coins are in kr+MLKEM_SYMBYTES */
+    indcpa_enc_x4(cmp_ptr, m, pk, kr_coins);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      fail[l] = ct_memcmp(ct[l], cmp[l], MLKEM_CIPHERTEXTBYTES);
+    }
+  }
+
+  /* Compute rejection keys J(z || ct) */
+  {
+    hash_j_x4_ctx j;
+    const uint8_t *z[KECCAK_WAY];
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      z[l] = sk[l] + MLKEM_SECRETKEYBYTES - MLKEM_SYMBYTES;
+    }
+    hash_j_x4_init(&j);
+    hash_j_x4_absorb(&j, z[0], z[1], z[2], z[3], MLKEM_SYMBYTES);
+    hash_j_x4_absorb(&j, ct[0], ct[1], ct[2], ct[3], MLKEM_CIPHERTEXTBYTES);
+    hash_j_x4_finalize(ss[0], ss[1], ss[2], ss[3], &j);
+  }
+
+  /* Copy true keys to return buffers if fail is 0 */
+  for (l = 0; l < KECCAK_WAY; l++)
+  {
+    ct_cmov_zero(ss[l], kr[l], MLKEM_SYMBYTES, fail[l]);
+  }
+
+  return 0;
+}
+
+int crypto_kem_dec_batch(size_t n, uint8_t *ss[], const uint8_t *ct[],
+                         const uint8_t *sk[])
+{
+  int rc = 0;
+  size_t i, l;
+
+  for (i = 0; i < n; i += KECCAK_WAY)
+  {
+    uint8_t *ss_x4[KECCAK_WAY];
+    const uint8_t *ct_x4[KECCAK_WAY], *sk_x4[KECCAK_WAY];
+    ALIGN uint8_t dummy[KECCAK_WAY][MLKEM_SSBYTES];
+    size_t rem = n - i;
+
+    /* A single leftover decapsulation is cheaper done on its own */
+    if (rem == 1)
+    {
+      rc |= crypto_kem_dec(ss[i], ct[i], sk[i]);
+      break;
+    }
+
+    /* Pad a partial last group by repeating its last entry */
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      size_t src = i + (l < rem ? l : rem - 1);
+      ss_x4[l] = l < rem ? ss[src] : dummy[l];
+      ct_x4[l] = ct[src];
+      sk_x4[l] = sk[src];
+    }
+
+    if (crypto_kem_dec_x4(ss_x4, ct_x4, sk_x4))
+    {
+      /* Some key in this group is invalid: process its entries one by one */
+      for (l = 0; l < KECCAK_WAY && l < rem; l++)
+      {
+        rc |= crypto_kem_dec(ss[i + l], ct[i + l], sk[i + l]);
+      }
+    }
+  }
+
+  return rc;
+}
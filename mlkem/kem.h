@@ -5,8 +5,10 @@
 #ifndef KEM_H
 #define KEM_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "cbmc.h"
+#include "indcpa.h"
 #include "params.h"
 
 #define CRYPTO_SECRETKEYBYTES MLKEM_SECRETKEYBYTES
@@ -22,6 +24,43 @@
 #define CRYPTO_ALGNAME "Kyber1024"
 #endif
 
+/* Temporaries of decapsulation */
+typedef struct
+{
+  union
+  {
+    indcpa_dec_workspace dec;
+    indcpa_enc_workspace enc;
+  } indcpa;
+  /* Re-encrypted ciphertext */
+  uint8_t cmp[MLKEM_CIPHERTEXTBYTES];
+} mlkem_dec_workspace;
+
+/*
+ * Workspace for crypto_kem_keypair_ws(), crypto_kem_enc_ws(),
+ * crypto_kem_dec_ws() and their _derand variants, holding the large
+ * temporaries (matrix, polynomial vectors, mulcaches and the
+ * re-encrypted ciphertext) that the other API functions keep on the stack.
+ *
+ * A workspace can be reused for any number of calls, but must not be
+ * used by two calls concurrently. Its contents are not meaningful
+ * between calls, but may contain secret data and should be zeroized
+ * before the memory is released.
+ *
+ * Callers that do not want to depend on the layout of the structure
+ * can allocate MLKEM_WORKSPACE_BYTES bytes aligned to
+ * MLKEM_WORKSPACE_ALIGN bytes instead.
+ */
+typedef union
+{
+  indcpa_keypair_workspace keypair;
+  indcpa_enc_workspace enc;
+  mlkem_dec_workspace dec;
+} mlkem_workspace;
+
+#define MLKEM_WORKSPACE_BYTES (sizeof(mlkem_workspace))
+#define MLKEM_WORKSPACE_ALIGN DEFAULT_ALIGN
+
 #define crypto_kem_keypair_derand MLKEM_NAMESPACE(keypair_derand)
 /*************************************************
  * Name:        crypto_kem_keypair_derand
@@ -70,6 +109,97 @@ __contract__(
   assigns(object_whole(sk))
 );
 
+#define crypto_kem_keypair_derand_ws MLKEM_NAMESPACE(keypair_derand_ws)
+/*************************************************
+ * Name:        crypto_kem_keypair_derand_ws
+ *
+ * Description: As crypto_kem_keypair_derand(), but with the large
+ *              temporaries in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *pk: pointer to output public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk: pointer to output private key
+ *                (an already allocated array of MLKEM_SECRETKEYBYTES bytes)
+ *              - uint8_t *coins: pointer to input randomness
+ *                (an already allocated array filled with 2*MLKEM_SYMBYTES
+ *random bytes)
+ *              - mlkem_workspace *ws: pointer to workspace
+ **
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_keypair_derand_ws(uint8_t *pk, uint8_t *sk,
+                                 const uint8_t *coins, mlkem_workspace *ws)
+__contract__(
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(sk, MLKEM_SECRETKEYBYTES))
+  requires(memory_no_alias(coins, 2 * MLKEM_SYMBYTES))
+  requires(memory_no_alias(ws, sizeof(mlkem_workspace)))
+  assigns(object_whole(pk))
+  assigns(object_whole(sk))
+  assigns(object_whole(ws))
+);
+
+#define crypto_kem_keypair_ws MLKEM_NAMESPACE(keypair_ws)
+/*************************************************
+ * Name:        crypto_kem_keypair_ws
+ *
+ * Description: As crypto_kem_keypair(), but with the large
+ *              temporaries in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *pk: pointer to output public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk: pointer to output private key
+ *                (an already allocated array of MLKEM_SECRETKEYBYTES bytes)
+ *              - mlkem_workspace *ws: pointer to workspace
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_keypair_ws(uint8_t *pk, uint8_t *sk, mlkem_workspace *ws)
+__contract__(
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(sk, MLKEM_SECRETKEYBYTES))
+  requires(memory_no_alias(ws, sizeof(mlkem_workspace)))
+  assigns(object_whole(pk))
+  assigns(object_whole(sk))
+  assigns(object_whole(ws))
+);
+
+#define crypto_kem_keypair_batch MLKEM_NAMESPACE(keypair_batch)
+/*************************************************
+ * Name:        crypto_kem_keypair_batch
+ *
+ * Description: Generates n public and private keys
+ *              for CCA-secure ML-KEM key encapsulation mechanism,
+ *              computing the Keccak instances of up to four key
+ *              generations together in the lanes of the x4 Keccak.
+ *
+ *              Equivalent to n calls to crypto_kem_keypair_derand().
+ *
+ * Arguments:   - size_t n: number of key pairs to generate
+ *              - uint8_t *pk[]: array of n pointers to output public keys
+ *                (already allocated arrays of MLKEM_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk[]: array of n pointers to output private keys
+ *                (already allocated arrays of MLKEM_SECRETKEYBYTES bytes)
+ *              - const uint8_t *coins[]: array of n pointers to input
+ *                randomness (already allocated arrays filled with
+ *                2*MLKEM_SYMBYTES random bytes)
+ **
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_keypair_batch(size_t n, uint8_t *pk[], uint8_t *sk[],
+                             const uint8_t *coins[])
+__contract__(
+  requires(memory_no_alias(pk, sizeof(uint8_t *) * n))
+  requires(memory_no_alias(sk, sizeof(uint8_t *) * n))
+  requires(memory_no_alias(coins, sizeof(uint8_t *) * n))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(pk[l], MLKEM_PUBLICKEYBYTES)))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(sk[l], MLKEM_SECRETKEYBYTES)))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(coins[l], 2 * MLKEM_SYMBYTES)))
+);
+
 #define crypto_kem_enc_derand MLKEM_NAMESPACE(enc_derand)
 /*************************************************
  * Name:        crypto_kem_enc_derand
@@ -127,6 +257,512 @@ __contract__(
   assigns(object_whole(ss))
 );
 
+#define crypto_kem_enc_derand_ws MLKEM_NAMESPACE(enc_derand_ws)
+/*************************************************
+ * Name:        crypto_kem_enc_derand_ws
+ *
+ * Description: As crypto_kem_enc_derand(), but with the large
+ *              temporaries in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - const uint8_t *coins: pointer to input randomness
+ *                (an already allocated array filled with MLKEM_SYMBYTES random
+ *bytes)
+ *              - mlkem_workspace *ws: pointer to workspace
+ **
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails.
+ **************************************************/
+int crypto_kem_enc_derand_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                             const uint8_t *coins, mlkem_workspace *ws)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  requires(memory_no_alias(ws, sizeof(mlkem_workspace)))
+  assigns(object_whole(ct))
+  assigns(object_whole(ss))
+  assigns(object_whole(ws))
+);
+
+#define crypto_kem_enc_ws MLKEM_NAMESPACE(enc_ws)
+/*************************************************
+ * Name:        crypto_kem_enc_ws
+ *
+ * Description: As crypto_kem_enc(), but with the large
+ *              temporaries in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - mlkem_workspace *ws: pointer to workspace
+ *
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails.
+ **************************************************/
+int crypto_kem_enc_ws(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                      mlkem_workspace *ws)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(ws, sizeof(mlkem_workspace)))
+  assigns(object_whole(ct))
+  assigns(object_whole(ss))
+  assigns(object_whole(ws))
+);
+
+/*
+ * Validated public key in expanded form, as produced by
+ * crypto_kem_pk_expand() and consumed by crypto_kem_enc_expanded().
+ *
+ * Caches everything in encapsulation that depends on the public key
+ * only: the result of the modulus check, H(pk), the unpacked public-key
+ * vector, and the transposed matrix A^T in the backend's NTT order.
+ */
+typedef struct
+{
+  indcpa_expanded_pk indcpa;
+  uint8_t hpk[MLKEM_SYMBYTES];
+} mlkem_expanded_pk;
+
+#define crypto_kem_pk_expand MLKEM_NAMESPACE(pk_expand)
+/*************************************************
+ * Name:        crypto_kem_pk_expand
+ *
+ * Description: Validates a public key and expands it for repeated
+ *              encapsulation via crypto_kem_enc_expanded().
+ *
+ * Arguments:   - mlkem_expanded_pk *epk: pointer to output expanded
+ *                public key
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ **
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails.
+ **************************************************/
+int crypto_kem_pk_expand(mlkem_expanded_pk *epk, const uint8_t *pk)
+__contract__(
+  requires(memory_no_alias(epk, sizeof(mlkem_expanded_pk)))
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  assigns(object_whole(epk))
+);
+
+#define crypto_kem_enc_expanded_derand MLKEM_NAMESPACE(enc_expanded_derand)
+/*************************************************
+ * Name:        crypto_kem_enc_expanded_derand
+ *
+ * Description: Generates cipher text and shared
+ *              secret for given expanded public key
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const mlkem_expanded_pk *epk: pointer to input public key,
+ *                expanded via crypto_kem_pk_expand()
+ *              - const uint8_t *coins: pointer to input randomness
+ *                (an already allocated array filled with MLKEM_SYMBYTES random
+ *bytes)
+ **
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss,
+                                   const mlkem_expanded_pk *epk,
+                                   const uint8_t *coins)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(epk, sizeof(mlkem_expanded_pk)))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  requires(forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,
+  array_abs_bound(epk->indcpa.at[x].vec[y].coeffs, 0, MLKEM_N - 1, UINT12_MAX))))
+  assigns(object_whole(ct))
+  assigns(object_whole(ss))
+);
+
+#define crypto_kem_enc_expanded MLKEM_NAMESPACE(enc_expanded)
+/*************************************************
+ * Name:        crypto_kem_enc_expanded
+ *
+ * Description: Generates cipher text and shared
+ *              secret for given expanded public key
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const mlkem_expanded_pk *epk: pointer to input public key,
+ *                expanded via crypto_kem_pk_expand()
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss,
+                            const mlkem_expanded_pk *epk)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(epk, sizeof(mlkem_expanded_pk)))
+  requires(forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,
+  array_abs_bound(epk->indcpa.at[x].vec[y].coeffs, 0, MLKEM_N - 1, UINT12_MAX))))
+  assigns(object_whole(ct))
+  assigns(object_whole(ss))
+);
+
+/*
+ * Cache of validated public keys for crypto_kem_enc_cached(), for callers
+ * that repeatedly encapsulate to a small set of public keys.
+ *
+ * The cache holds up to `capacity` expanded public keys, keyed by H(pk),
+ * and evicts the least recently used one when full. The entries are
+ * provided by the caller, which is thus free to choose the capacity.
+ * The cache only contains public data.
+ *
+ * If lock and unlock functions are given to crypto_kem_pk_cache_init(),
+ * every access to the cache is bracketed by lock(lock_arg) and
+ * unlock(lock_arg), so a cache with e.g. a mutex as lock can be shared
+ * between threads. The lock is not held during the encapsulation itself.
+ */
+typedef struct
+{
+  mlkem_expanded_pk epk;
+  /* Value of the cache clock at the last use; 0 if the entry is empty */
+  uint64_t last_use;
+} mlkem_pk_cache_entry;
+
+typedef void (*mlkem_pk_cache_lock_fn)(void *arg);
+
+typedef struct
+{
+  mlkem_pk_cache_entry *entries;
+  size_t capacity;
+  uint64_t clock;
+  uint64_t hits;
+  uint64_t misses;
+  mlkem_pk_cache_lock_fn lock;
+  mlkem_pk_cache_lock_fn unlock;
+  void *lock_arg;
+} mlkem_pk_cache;
+
+#define crypto_kem_pk_cache_init MLKEM_NAMESPACE(pk_cache_init)
+/*************************************************
+ * Name:        crypto_kem_pk_cache_init
+ *
+ * Description: Initializes an empty public key cache.
+ *
+ * Arguments:   - mlkem_pk_cache *cache: pointer to the cache to initialize
+ *              - mlkem_pk_cache_entry *entries: pointer to storage for
+ *                the cache entries (an already allocated array of
+ *                capacity entries)
+ *              - size_t capacity: maximum number of cached public keys
+ *              - mlkem_pk_cache_lock_fn lock, unlock: functions to
+ *                serialize accesses to the cache, or NULL if the cache
+ *                is only used by one thread at a time
+ *              - void *lock_arg: argument passed to lock and unlock
+ **
+ * Returns 0 on success, and -1 if capacity is 0 or only one of lock
+ * and unlock is given.
+ **************************************************/
+int crypto_kem_pk_cache_init(mlkem_pk_cache *cache,
+                             mlkem_pk_cache_entry *entries, size_t capacity,
+                             mlkem_pk_cache_lock_fn lock,
+                             mlkem_pk_cache_lock_fn unlock, void *lock_arg)
+__contract__(
+  requires(memory_no_alias(cache, sizeof(mlkem_pk_cache)))
+  requires(memory_no_alias(entries, sizeof(mlkem_pk_cache_entry) * capacity))
+  assigns(object_whole(cache))
+  assigns(object_whole(entries))
+);
+
+#define crypto_kem_pk_cache_stats MLKEM_NAMESPACE(pk_cache_stats)
+/*************************************************
+ * Name:        crypto_kem_pk_cache_stats
+ *
+ * Description: Reads the hit and miss counters of a public key cache.
+ *              A lookup of a public key that fails the modulus check
+ *              counts as a miss.
+ *
+ * Arguments:   - mlkem_pk_cache *cache: pointer to the cache
+ *              - uint64_t *hits: pointer to output number of lookups
+ *                that found the public key in the cache
+ *              - uint64_t *misses: pointer to output number of lookups
+ *                that did not
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_kem_pk_cache_stats(mlkem_pk_cache *cache, uint64_t *hits,
+                              uint64_t *misses)
+__contract__(
+  requires(memory_no_alias(cache, sizeof(mlkem_pk_cache)))
+  requires(memory_no_alias(hits, sizeof(uint64_t)))
+  requires(memory_no_alias(misses, sizeof(uint64_t)))
+  assigns(object_whole(hits))
+  assigns(object_whole(misses))
+);
+
+/* clang-format off */
+/* Bound on the matrices of all entries in use of a public key cache, as
+ * required by crypto_kem_enc_expanded_derand() */
+#define pk_cache_bound(cache)                                                 \
+  forall(size_t, i, 0, (cache)->capacity - 1,                                 \
+    (cache)->entries[i].last_use != 0 ==>                                     \
+    forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,             \
+      array_abs_bound((cache)->entries[i].epk.indcpa.at[x].vec[y].coeffs,     \
+                      0, MLKEM_N - 1, UINT12_MAX))))
+/* clang-format on */
+
+#define crypto_kem_enc_cached_derand MLKEM_NAMESPACE(enc_cached_derand)
+/*************************************************
+ * Name:        crypto_kem_enc_cached_derand
+ *
+ * Description: Generates cipher text and shared secret for given
+ *              public key, looking up its expanded form in a cache.
+ *
+ *              On a hit, the modulus check, the unpacking of the public
+ *              key and the generation of the matrix are skipped. On a
+ *              miss, the public key is validated and expanded as in
+ *              crypto_kem_pk_expand(), and added to the cache if valid.
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - mlkem_pk_cache *cache: pointer to the cache, initialized
+ *                via crypto_kem_pk_cache_init()
+ *              - const uint8_t *coins: pointer to input randomness
+ *                (an already allocated array filled with MLKEM_SYMBYTES random
+ *bytes)
+ **
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails.
+ **************************************************/
+int crypto_kem_enc_cached_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                                 mlkem_pk_cache *cache, const uint8_t *coins)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(cache, sizeof(mlkem_pk_cache)))
+  requires(cache->capacity > 0)
+  requires(memory_no_alias(cache->entries,
+    sizeof(mlkem_pk_cache_entry) * cache->capacity))
+  requires(pk_cache_bound(cache))
+  requires(memory_no_alias(coins, MLKEM_SYMBYTES))
+  assigns(memory_slice(ct, MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ss, MLKEM_SSBYTES))
+  assigns(cache->clock, cache->hits, cache->misses)
+  assigns(memory_slice(cache->entries,
+    sizeof(mlkem_pk_cache_entry) * cache->capacity))
+  ensures(pk_cache_bound(cache))
+);
+
+#define crypto_kem_enc_cached MLKEM_NAMESPACE(enc_cached)
+/*************************************************
+ * Name:        crypto_kem_enc_cached
+ *
+ * Description: Generates cipher text and shared secret for given
+ *              public key, looking up its expanded form in a cache.
+ *              See crypto_kem_enc_cached_derand().
+ *
+ * Arguments:   - uint8_t *ct: pointer to output cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk: pointer to input public key
+ *                (an already allocated array of MLKEM_PUBLICKEYBYTES bytes)
+ *              - mlkem_pk_cache *cache: pointer to the cache, initialized
+ *                via crypto_kem_pk_cache_init()
+ *
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails.
+ **************************************************/
+int crypto_kem_enc_cached(uint8_t *ct, uint8_t *ss, const uint8_t *pk,
+                          mlkem_pk_cache *cache)
+__contract__(
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(pk, MLKEM_PUBLICKEYBYTES))
+  requires(memory_no_alias(cache, sizeof(mlkem_pk_cache)))
+  requires(cache->capacity > 0)
+  requires(memory_no_alias(cache->entries,
+    sizeof(mlkem_pk_cache_entry) * cache->capacity))
+  requires(pk_cache_bound(cache))
+  assigns(memory_slice(ct, MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ss, MLKEM_SSBYTES))
+  assigns(cache->clock, cache->hits, cache->misses)
+  assigns(memory_slice(cache->entries,
+    sizeof(mlkem_pk_cache_entry) * cache->capacity))
+  ensures(pk_cache_bound(cache))
+);
+
+#define crypto_kem_enc_x4_derand MLKEM_NAMESPACE(enc_x4_derand)
+/*************************************************
+ * Name:        crypto_kem_enc_x4_derand
+ *
+ * Description: Generates four cipher texts and shared secrets
+ *              for four (not necessarily distinct) public keys.
+ *
+ *              Equivalent to four calls to crypto_kem_enc_derand(),
+ *              but computes all Keccak instances of the four
+ *              encapsulations together in the lanes of the x4 Keccak.
+ *
+ * Arguments:   - uint8_t *ct[4]: pointers to output cipher texts
+ *                (already allocated arrays of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss[4]: pointers to output shared secrets
+ *                (already allocated arrays of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk[4]: pointers to input public keys
+ *                (already allocated arrays of MLKEM_PUBLICKEYBYTES bytes)
+ *              - const uint8_t *coins[4]: pointers to input randomness
+ *                (already allocated arrays filled with MLKEM_SYMBYTES random
+ *bytes)
+ **
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails for any of the public keys. In this case, no output
+ * is written.
+ **************************************************/
+int crypto_kem_enc_x4_derand(uint8_t *ct[4], uint8_t *ss[4],
+                             const uint8_t *pk[4], const uint8_t *coins[4])
+/* The public keys need not be distinct, so we only require them to be
+   readable. */
+__contract__(
+  requires(memory_no_alias(ct, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(ss, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(pk, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(coins, sizeof(uint8_t *) * 4))
+  requires(forall(int, l, 0, 3, memory_no_alias(ct[l], MLKEM_CIPHERTEXTBYTES)))
+  requires(forall(int, l, 0, 3, memory_no_alias(ss[l], MLKEM_SSBYTES)))
+  requires(forall(int, l, 0, 3, readable(pk[l], MLKEM_PUBLICKEYBYTES)))
+  requires(forall(int, l, 0, 3, readable(coins[l], MLKEM_SYMBYTES)))
+  assigns(memory_slice(ct[0], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[1], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[2], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[3], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ss[0], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[1], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[2], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[3], MLKEM_SSBYTES))
+);
+
+#define crypto_kem_enc_x4 MLKEM_NAMESPACE(enc_x4)
+/*************************************************
+ * Name:        crypto_kem_enc_x4
+ *
+ * Description: Generates four cipher texts and shared secrets
+ *              for four (not necessarily distinct) public keys.
+ *
+ * Arguments:   - uint8_t *ct[4]: pointers to output cipher texts
+ *                (already allocated arrays of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - uint8_t *ss[4]: pointers to output shared secrets
+ *                (already allocated arrays of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *pk[4]: pointers to input public keys
+ *                (already allocated arrays of MLKEM_PUBLICKEYBYTES bytes)
+ *
+ * Returns 0 on success, and -1 if the public key modulus check (see Section 7.2
+ * of FIPS203) fails for any of the public keys. In this case, no output
+ * is written.
+ **************************************************/
+int crypto_kem_enc_x4(uint8_t *ct[4], uint8_t *ss[4], const uint8_t *pk[4])
+/* The public keys need not be distinct, so we only require them to be
+   readable. */
+__contract__(
+  requires(memory_no_alias(ct, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(ss, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(pk, sizeof(uint8_t *) * 4))
+  requires(forall(int, l, 0, 3, memory_no_alias(ct[l], MLKEM_CIPHERTEXTBYTES)))
+  requires(forall(int, l, 0, 3, memory_no_alias(ss[l], MLKEM_SSBYTES)))
+  requires(forall(int, l, 0, 3, readable(pk[l], MLKEM_PUBLICKEYBYTES)))
+  assigns(memory_slice(ct[0], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[1], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[2], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ct[3], MLKEM_CIPHERTEXTBYTES))
+  assigns(memory_slice(ss[0], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[1], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[2], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[3], MLKEM_SSBYTES))
+);
+
+/*
+ * Validated secret key in expanded form, as produced by
+ * crypto_kem_sk_expand() and consumed by crypto_kem_dec_expanded().
+ *
+ * Besides the unpacked secret-key vector, this holds the expanded form
+ * of the embedded public key, needed for the re-encryption step, and
+ * the implicit rejection value z.
+ */
+typedef struct
+{
+  indcpa_expanded_sk indcpa;
+  mlkem_expanded_pk pk;
+  uint8_t z[MLKEM_SYMBYTES];
+} mlkem_expanded_sk;
+
+#define crypto_kem_sk_expand MLKEM_NAMESPACE(sk_expand)
+/*************************************************
+ * Name:        crypto_kem_sk_expand
+ *
+ * Description: Validates a secret key and expands it for repeated
+ *              decapsulation via crypto_kem_dec_expanded().
+ *
+ * Arguments:   - mlkem_expanded_sk *esk: pointer to output expanded
+ *                secret key
+ *              - const uint8_t *sk: pointer to input private key
+ *                (an already allocated array of MLKEM_SECRETKEYBYTES bytes)
+ **
+ * Returns 0 on success, and -1 if the secret key hash check (see Section 7.3 of
+ * FIPS203) fails.
+ *
+ * The expanded secret key contains secret data and should be treated
+ * (and eventually zeroized) like the secret key itself.
+ **************************************************/
+int crypto_kem_sk_expand(mlkem_expanded_sk *esk, const uint8_t *sk)
+__contract__(
+  requires(memory_no_alias(esk, sizeof(mlkem_expanded_sk)))
+  requires(memory_no_alias(sk, MLKEM_SECRETKEYBYTES))
+  assigns(object_whole(esk))
+);
+
+#define crypto_kem_dec_expanded MLKEM_NAMESPACE(dec_expanded)
+/*************************************************
+ * Name:        crypto_kem_dec_expanded
+ *
+ * Description: Generates shared secret for given
+ *              cipher text and expanded private key
+ *
+ * Arguments:   - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *ct: pointer to input cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - const mlkem_expanded_sk *esk: pointer to input private key,
+ *                expanded via crypto_kem_sk_expand()
+ *
+ * Returns 0 (success)
+ *
+ * If the ciphertext is invalid, ss will contain a pseudo-random value.
+ **************************************************/
+int crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct,
+                            const mlkem_expanded_sk *esk)
+__contract__(
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(esk, sizeof(mlkem_expanded_sk)))
+  requires(forall(int, k0, 0, MLKEM_K - 1,
+  array_abs_bound(esk->indcpa.skpv.vec[k0].coeffs, 0, MLKEM_N - 1, UINT12_MAX)))
+  requires(forall(int, x, 0, MLKEM_K - 1, forall(int, y, 0, MLKEM_K - 1,
+  array_abs_bound(esk->pk.indcpa.at[x].vec[y].coeffs, 0, MLKEM_N - 1, UINT12_MAX))))
+  assigns(object_whole(ss))
+);
+
 #define crypto_kem_dec MLKEM_NAMESPACE(dec)
 /*************************************************
  * Name:        crypto_kem_dec
@@ -154,4 +790,119 @@ __contract__(
   assigns(object_whole(ss))
 );
 
+#define crypto_kem_dec_ws MLKEM_NAMESPACE(dec_ws)
+/*************************************************
+ * Name:        crypto_kem_dec_ws
+ *
+ * Description: As crypto_kem_dec(), but with the large
+ *              temporaries in a caller-provided workspace.
+ *
+ * Arguments:   - uint8_t *ss: pointer to output shared secret
+ *                (an already allocated array of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *ct: pointer to input cipher text
+ *                (an already allocated array of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - const uint8_t *sk: pointer to input private key
+ *                (an already allocated array of MLKEM_SECRETKEYBYTES bytes)
+ *              - mlkem_workspace *ws: pointer to workspace
+ *
+ * Returns 0 on success, and -1 if the secret key hash check (see Section 7.3 of
+ * FIPS203) fails.
+ *
+ * On failure, ss will contain a pseudo-random value.
+ **************************************************/
+int crypto_kem_dec_ws(uint8_t *ss, const uint8_t *ct, const uint8_t *sk,
+                      mlkem_workspace *ws)
+__contract__(
+  requires(memory_no_alias(ss, MLKEM_SSBYTES))
+  requires(memory_no_alias(ct, MLKEM_CIPHERTEXTBYTES))
+  requires(memory_no_alias(sk, MLKEM_SECRETKEYBYTES))
+  requires(memory_no_alias(ws, sizeof(mlkem_workspace)))
+  assigns(object_whole(ss))
+  assigns(object_whole(ws))
+);
+
+#define crypto_kem_dec_x4 MLKEM_NAMESPACE(dec_x4)
+/*************************************************
+ * Name:        crypto_kem_dec_x4
+ *
+ * Description: Generates four shared secrets for four cipher texts
+ *              and (not necessarily distinct) private keys.
+ *
+ *              Equivalent to four calls to crypto_kem_dec(), but
+ *              computes all Keccak instances of the four decapsulations,
+ *              including the re-encryption, in the lanes of the x4 Keccak.
+ *
+ * Arguments:   - uint8_t *ss[4]: pointers to output shared secrets
+ *                (already allocated arrays of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *ct[4]: pointers to input cipher texts
+ *                (already allocated arrays of MLKEM_CIPHERTEXTBYTES bytes)
+ *              - const uint8_t *sk[4]: pointers to input private keys
+ *                (already allocated arrays of MLKEM_SECRETKEYBYTES bytes)
+ *
+ * Returns 0 on success, and -1 if the secret key hash check (see Section 7.3 of
+ * FIPS203) fails for any of the private keys. In this case, no output
+ * is written.
+ *
+ * For invalid cipher texts, the respective ss will contain a pseudo-random
+ * value.
+ **************************************************/
+int crypto_kem_dec_x4(uint8_t *ss[4], const uint8_t *ct[4],
+                      const uint8_t *sk[4])
+/* crypto_kem_dec_batch() pads a partial group by repeating entries and
+   directing the surplus shared secrets to rows of a single dummy array,
+   so the lanes are only required to be readable or writeable. Within
+   a lane, the cipher text and private key must be separate objects,
+   as required by indcpa_dec(). */
+__contract__(
+  requires(memory_no_alias(ss, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(ct, sizeof(uint8_t *) * 4))
+  requires(memory_no_alias(sk, sizeof(uint8_t *) * 4))
+  requires(forall(int, l, 0, 3, writeable(ss[l], MLKEM_SSBYTES)))
+  requires(forall(int, l, 0, 3, readable(ct[l], MLKEM_CIPHERTEXTBYTES)))
+  requires(forall(int, l, 0, 3, readable(sk[l], MLKEM_SECRETKEYBYTES)))
+  requires(forall(int, l, 0, 3, !same_object(ct[l], sk[l])))
+  assigns(memory_slice(ss[0], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[1], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[2], MLKEM_SSBYTES))
+  assigns(memory_slice(ss[3], MLKEM_SSBYTES))
+);
+
+#define crypto_kem_dec_batch MLKEM_NAMESPACE(dec_batch)
+/*************************************************
+ * Name:        crypto_kem_dec_batch
+ *
+ * Description: Generates n shared secrets for n cipher texts
+ *              and (not necessarily distinct) private keys,
+ *              processing them in groups of four via crypto_kem_dec_x4().
+ *
+ * Arguments:   - size_t n: number of decapsulations
+ *              - uint8_t *ss[]: array of n pointers to output shared secrets
+ *                (already allocated arrays of MLKEM_SSBYTES bytes)
+ *              - const uint8_t *ct[]: array of n pointers to input cipher
+ *                texts (already allocated arrays of MLKEM_CIPHERTEXTBYTES
+ *                bytes)
+ *              - const uint8_t *sk[]: array of n pointers to input private
+ *                keys (already allocated arrays of MLKEM_SECRETKEYBYTES bytes)
+ *
+ * Returns 0 on success, and -1 if the secret key hash check (see Section 7.3 of
+ * FIPS203) fails for any of the private keys. The shared secrets for
+ * all other private keys are computed regardless.
+ *
+ * For invalid cipher texts, the respective ss will contain a pseudo-random
+ * value.
+ **************************************************/
+int crypto_kem_dec_batch(size_t n, uint8_t *ss[], const uint8_t *ct[],
+                         const uint8_t *sk[])
+__contract__(
+  requires(memory_no_alias(ss, sizeof(uint8_t *) * n))
+  requires(memory_no_alias(ct, sizeof(uint8_t *) * n))
+  requires(memory_no_alias(sk, sizeof(uint8_t *) * n))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(ss[l], MLKEM_SSBYTES)))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(ct[l], MLKEM_CIPHERTEXTBYTES)))
+  requires(n > 0 ==> forall(size_t, l, 0, n - 1,
+    memory_no_alias(sk[l], MLKEM_SECRETKEYBYTES)))
+);
+
 #endif
@@ -6,8 +6,13 @@
 #define MLKEM_NATIVE_NAMESPACE_H
 
 #if !defined(MLKEM_NATIVE_ARITH_BACKEND_NAME)
+#if defined(MLKEM_NATIVE_DISPATCH)
+/* Public API forwarding to one of several backends, see dispatch.c */
+#define MLKEM_NATIVE_ARITH_BACKEND_NAME DISPATCH
+#else
 #define MLKEM_NATIVE_ARITH_BACKEND_NAME C
 #endif
+#endif
 
 /* Don't change parameters below this line */
 #if (MLKEM_K == 2)
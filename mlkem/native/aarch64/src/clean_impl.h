@@ -10,6 +10,7 @@
 #else
 #define MLKEM_NATIVE_ARITH_PROFILE_IMPL_H
 
+#include <string.h>
 #include "arith_native_aarch64.h"
 
 #include "poly.h"
@@ -70,11 +71,31 @@ static INLINE void poly_tobytes_native(uint8_t r[MLKEM_POLYBYTES],
 static INLINE int rej_uniform_native(int16_t *r, unsigned int len,
                                      const uint8_t *buf, unsigned int buflen)
 {
-  if (len != MLKEM_N || buflen % 24 != 0)
+  int16_t tmp[MLKEM_N];
+  unsigned int ctr;
+
+  if (len > MLKEM_N || buflen % 24 != 0)
   {
     return -1;
   }
-  return (int)rej_uniform_asm_clean(r, buf, buflen, rej_uniform_table);
+
+  if (len == MLKEM_N)
+  {
+    return (int)rej_uniform_asm_clean(r, buf, buflen, rej_uniform_table);
+  }
+
+  /*
+   * The assembly always samples up to MLKEM_N coefficients, so for
+   * shorter requests (e.g. when resuming after a first squeeze),
+   * sample into a temporary buffer and keep the first len entries.
+   */
+  ctr = rej_uniform_asm_clean(tmp, buf, buflen, rej_uniform_table);
+  if (ctr > len)
+  {
+    ctr = len;
+  }
+  memcpy(r, tmp, ctr * sizeof(int16_t));
+  return (int)ctr;
 }
 
 #endif /* MLKEM_NATIVE_ARITH_PROFILE_IMPL_H */
@@ -193,6 +193,34 @@ static INLINE void polyvec_basemul_acc_montgomery_cached_native(
     const polyvec_mulcache *b_cache);
 #endif
 
+#if defined(MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY)
+/*************************************************
+ * Name:        polyvec_basemul_acc_montgomery_native
+ *
+ * Description: Compute scalar product of two vectors of polynomials in
+ *              NTT domain, without a multiplication cache for b.
+ *
+ *              Backends which do not use the multiplication cache should
+ *              set this, so that callers which only multiply by b once
+ *              need not compute and store a cache for it.
+ *
+ * Arguments:   INPUT:
+ *              - a: First polynomial operand.
+ *                 This must be in NTT domain and in bitreversed order, or of
+ *                 a custom order if MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER is set.
+ *                 See the documentation of MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER
+ *                 for more information.
+ *              - b: Second polynomial operand.
+ *                 As for a.
+ *              OUTPUT
+ *              - r: Result of the base multiplication. This is again
+ *                   in NTT domain, and of the same order as a and b.
+ **************************************************/
+static INLINE void polyvec_basemul_acc_montgomery_native(poly *r,
+                                                         const polyvec *a,
+                                                         const polyvec *b);
+#endif /* MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY */
+
 #if defined(MLKEM_USE_NATIVE_POLY_TOBYTES)
 /*************************************************
  * Name:        poly_tobytes_native
@@ -230,6 +258,225 @@ static INLINE void poly_frombytes_native(poly *a,
                                          const uint8_t r[MLKEM_POLYBYTES]);
 #endif /* MLKEM_USE_NATIVE_POLY_FROMBYTES */
 
+#if defined(MLKEM_USE_NATIVE_POLY_MODULUS_CHECK)
+/*************************************************
+ * Name:        poly_modulus_check_native
+ *
+ * Description: Checks that all 12-bit packed coefficients of a
+ *              serialized polynomial are in the range 0 .. MLKEM_Q-1.
+ *              Only used on public data, so need not be constant-time.
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input byte array
+ *                   (of MLKEM_POLYBYTES bytes)
+ *
+ * Returns 0 if all coefficients are in range, and a nonzero value
+ * otherwise.
+ **************************************************/
+static INLINE int poly_modulus_check_native(const uint8_t a[MLKEM_POLYBYTES]);
+#endif /* MLKEM_USE_NATIVE_POLY_MODULUS_CHECK */
+
+#if defined(MLKEM_USE_NATIVE_POLY_COMPRESS_DU)
+/*************************************************
+ * Name:        poly_compress_du_native
+ *
+ * Description: Compression (du bits) and subsequent serialization of a
+ *              polynomial. Must produce the same output as
+ *              poly_compress_du().
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input polynomial, in normal order,
+ *                with each coefficient in the range 0 .. Q-1
+ *              OUTPUT
+ *              - r: pointer to output byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DU bytes)
+ **************************************************/
+static INLINE void poly_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a);
+#endif /* MLKEM_USE_NATIVE_POLY_COMPRESS_DU */
+
+#if defined(MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU)
+/*************************************************
+ * Name:        poly_decompress_du_native
+ *
+ * Description: De-serialization and subsequent decompression (du bits)
+ *              of a polynomial. Must produce the same output as
+ *              poly_decompress_du().
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DU bytes)
+ *              OUTPUT
+ *              - r: pointer to output polynomial, in normal order,
+ *                with each coefficient in the range 0 .. Q-1
+ **************************************************/
+static INLINE void poly_decompress_du_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU]);
+#endif /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU */
+
+#if defined(MLKEM_USE_NATIVE_POLY_COMPRESS_DV)
+/*************************************************
+ * Name:        poly_compress_dv_native
+ *
+ * Description: Compression (dv bits) and subsequent serialization of a
+ *              polynomial. Must produce the same output as
+ *              poly_compress_dv().
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input polynomial, in normal order,
+ *                with each coefficient in the range 0 .. Q-1
+ *              OUTPUT
+ *              - r: pointer to output byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DV bytes)
+ **************************************************/
+static INLINE void poly_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a);
+#endif /* MLKEM_USE_NATIVE_POLY_COMPRESS_DV */
+
+#if defined(MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV)
+/*************************************************
+ * Name:        poly_decompress_dv_native
+ *
+ * Description: De-serialization and subsequent decompression (dv bits)
+ *              of a polynomial. Must produce the same output as
+ *              poly_decompress_dv().
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DV bytes)
+ *              OUTPUT
+ *              - r: pointer to output polynomial, in normal order,
+ *                with each coefficient in the range 0 .. Q-1
+ **************************************************/
+static INLINE void poly_decompress_dv_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV]);
+#endif /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV */
+
+#if defined(MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU)
+/*************************************************
+ * Name:        poly_invntt_add_compress_du_native
+ *
+ * Description: Computes invNTT(b) + e and compresses and serializes it
+ *              with du bits per coefficient. Must produce the same output
+ *              as poly_invntt_add_compress_du().
+ *
+ * Arguments:   INPUT:
+ *              - b: pointer to input polynomial in NTT domain, in the
+ *                order expected by intt_native(), with arbitrary
+ *                coefficients in int16_t. May be overwritten.
+ *              - e: const pointer to error polynomial, in normal order,
+ *                with coefficients bound by MLKEM_ETA1 in absolute value
+ *              OUTPUT
+ *              - r: pointer to output byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DU bytes)
+ **************************************************/
+static INLINE void poly_invntt_add_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], poly *b, const poly *e);
+#endif /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU */
+
+#if defined(MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV)
+/*************************************************
+ * Name:        poly_invntt_add_compress_dv_native
+ *
+ * Description: Computes invNTT(a) + e + m and compresses and serializes it
+ *              with dv bits per coefficient. Must produce the same output
+ *              as poly_invntt_add_compress_dv().
+ *
+ * Arguments:   INPUT:
+ *              - a: pointer to input polynomial in NTT domain, in the
+ *                order expected by intt_native(), with arbitrary
+ *                coefficients in int16_t. May be overwritten.
+ *              - e: const pointer to error polynomial, in normal order,
+ *                with coefficients bound by MLKEM_ETA2 in absolute value
+ *              - m: const pointer to message polynomial, in normal order,
+ *                with coefficients in the range 0 .. Q-1
+ *              OUTPUT
+ *              - r: pointer to output byte array
+ *                   (of MLKEM_POLYCOMPRESSEDBYTES_DV bytes)
+ **************************************************/
+static INLINE void poly_invntt_add_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], poly *a, const poly *e,
+    const poly *m);
+#endif /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV */
+
+#if defined(MLKEM_USE_NATIVE_POLY_FROMMSG)
+/*************************************************
+ * Name:        poly_frommsg_native
+ *
+ * Description: Convert a 32-byte message to a polynomial, mapping each
+ *              bit to 0 or (Q+1)/2. Must produce the same output as
+ *              poly_frommsg(), and must not branch on or index memory
+ *              by the message bits.
+ *
+ * Arguments:   INPUT:
+ *              - msg: const pointer to input message
+ *                     (of MLKEM_INDCPA_MSGBYTES bytes)
+ *              OUTPUT
+ *              - r: pointer to output polynomial, in normal order
+ **************************************************/
+static INLINE void poly_frommsg_native(
+    poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES]);
+#endif /* MLKEM_USE_NATIVE_POLY_FROMMSG */
+
+#if defined(MLKEM_USE_NATIVE_POLY_TOMSG)
+/*************************************************
+ * Name:        poly_tomsg_native
+ *
+ * Description: Convert a polynomial to a 32-byte message by compressing
+ *              each coefficient to 1 bit. Must produce the same output as
+ *              poly_tomsg(), and must run in constant time.
+ *
+ * Arguments:   INPUT:
+ *              - a: const pointer to input polynomial, in normal order,
+ *                with each coefficient in the range 0 .. Q-1
+ *              OUTPUT
+ *              - msg: pointer to output message
+ *                     (of MLKEM_INDCPA_MSGBYTES bytes)
+ **************************************************/
+static INLINE void poly_tomsg_native(uint8_t msg[MLKEM_INDCPA_MSGBYTES],
+                                     const poly *a);
+#endif /* MLKEM_USE_NATIVE_POLY_TOMSG */
+
+#if defined(MLKEM_USE_NATIVE_POLY_CBD_ETA1)
+/*************************************************
+ * Name:        poly_cbd_eta1_native
+ *
+ * Description: Given an array of uniformly random bytes, compute
+ *              polynomial with coefficients distributed according to
+ *              a centered binomial distribution with parameter MLKEM_ETA1.
+ *              Must produce the same output as poly_cbd_eta1().
+ *
+ * Arguments:   INPUT:
+ *              - buf: const pointer to input byte array
+ *                     (of MLKEM_ETA1 * MLKEM_N / 4 bytes)
+ *              OUTPUT
+ *              - r: pointer to output polynomial, in normal order,
+ *                with each coefficient in the range -ETA1 .. ETA1
+ **************************************************/
+static INLINE void poly_cbd_eta1_native(
+    poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4]);
+#endif /* MLKEM_USE_NATIVE_POLY_CBD_ETA1 */
+
+#if defined(MLKEM_USE_NATIVE_POLY_CBD_ETA2)
+/*************************************************
+ * Name:        poly_cbd_eta2_native
+ *
+ * Description: Given an array of uniformly random bytes, compute
+ *              polynomial with coefficients distributed according to
+ *              a centered binomial distribution with parameter MLKEM_ETA2.
+ *              Must produce the same output as poly_cbd_eta2().
+ *
+ * Arguments:   INPUT:
+ *              - buf: const pointer to input byte array
+ *                     (of MLKEM_ETA2 * MLKEM_N / 4 bytes)
+ *              OUTPUT
+ *              - r: pointer to output polynomial, in normal order,
+ *                with each coefficient in the range -ETA2 .. ETA2
+ **************************************************/
+static INLINE void poly_cbd_eta2_native(
+    poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4]);
+#endif /* MLKEM_USE_NATIVE_POLY_CBD_ETA2 */
+
 #if defined(MLKEM_USE_NATIVE_REJ_UNIFORM)
 /*************************************************
  * Name:        rej_uniform_native
@@ -29,4 +29,11 @@
 #include "x86_64/default.h"
 #endif /* SYS_X86_64 */
 
+/*
+ * There is no default for other targets. The portable SIMD backend in
+ * portable_simd/ is not selected automatically, as it is only tested on
+ * x86_64 and AArch64 so far; it can be chosen explicitly by setting
+ * MLKEM_NATIVE_ARITH_BACKEND to "native/portable_simd/default.h".
+ */
+
 #endif /* MLKEM_NATIVE_ARITH_BACKEND_DEFAULT_H */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLKEM_PORTABLE_SIMD_NATIVE_H
+#define MLKEM_PORTABLE_SIMD_NATIVE_H
+
+#include "common.h"
+
+#include <stdint.h>
+#include "consts_portable_simd.h"
+#include "polyvec.h"
+
+#define ntt_portable_simd MLKEM_NAMESPACE(ntt_portable_simd)
+void ntt_portable_simd(int16_t *r, const int16_t *qdata);
+
+#define invntt_portable_simd MLKEM_NAMESPACE(invntt_portable_simd)
+void invntt_portable_simd(int16_t *r, const int16_t *qdata);
+
+#define reduce_portable_simd MLKEM_NAMESPACE(reduce_portable_simd)
+void reduce_portable_simd(int16_t *r);
+
+#define tomont_portable_simd MLKEM_NAMESPACE(tomont_portable_simd)
+void tomont_portable_simd(int16_t *r);
+
+#define poly_mulcache_compute_portable_simd \
+  MLKEM_NAMESPACE(poly_mulcache_compute_portable_simd)
+void poly_mulcache_compute_portable_simd(int16_t *x, const int16_t *a,
+                                         const int16_t *qdata);
+
+#define polyvec_basemul_acc_montgomery_cached_portable_simd \
+  MLKEM_NAMESPACE(polyvec_basemul_acc_montgomery_cached_portable_simd)
+void polyvec_basemul_acc_montgomery_cached_portable_simd(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache);
+
+#define ntttobytes_portable_simd MLKEM_NAMESPACE(ntttobytes_portable_simd)
+void ntttobytes_portable_simd(uint8_t *r, const int16_t *a);
+
+#define nttfrombytes_portable_simd MLKEM_NAMESPACE(nttfrombytes_portable_simd)
+void nttfrombytes_portable_simd(int16_t *r, const uint8_t *a);
+
+#endif /* MLKEM_PORTABLE_SIMD_NATIVE_H */
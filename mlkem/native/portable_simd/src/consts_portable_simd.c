@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD)
+
+#include "consts_portable_simd.h"
+
+ALIGN const int16_t qdata_portable_simd[_PSIMD_ZETAS_LEN] = {
+#include "portable_simd_zetas.i"
+};
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_consts_portable_simd \
+  MLKEM_NAMESPACE(empty_cu_consts_portable_simd)
+int empty_cu_consts_portable_simd;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
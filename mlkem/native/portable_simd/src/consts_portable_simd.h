@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CONSTS_PORTABLE_SIMD_H
+#define CONSTS_PORTABLE_SIMD_H
+
+#include <stdint.h>
+#include "common.h"
+
+/*
+ * Layout of the portable SIMD twiddle table, in int16 offsets.
+ * See gen_portable_simd_ntt_zetas() in scripts/autogenerate_files.py.
+ *
+ * Except for the scalars used by layers 1-5, every entry is a vector of
+ * 8 twisted constants (c * q^-1 mod 2^16) followed by a vector of the
+ * 8 constants c themselves.
+ */
+#define _PSIMD_ZETAS_L12345 0      /* zetas[0..31]; twisted at +32 */
+#define _PSIMD_ZETAS_L67 64        /* 16 blocks of 32, see the NTT */
+#define _PSIMD_ZETAS_INV_L76 576   /* 16 blocks of 32 */
+#define _PSIMD_ZETAS_MULCACHE 1088 /* 16 blocks of 16 */
+#define _PSIMD_ZETAS_LEN 1344
+
+#define qdata_portable_simd MLKEM_NAMESPACE(qdata_portable_simd)
+extern const int16_t qdata_portable_simd[_PSIMD_ZETAS_LEN];
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* ML-KEM arithmetic native profile using compiler vector extensions */
+
+#ifdef MLKEM_NATIVE_ARITH_PROFILE_IMPL_H
+#error Only one MLKEM_ARITH assembly profile can be defined -- did you include multiple profiles?
+#else
+#define MLKEM_NATIVE_ARITH_PROFILE_IMPL_H
+
+#include "arith_native_portable_simd.h"
+#include "poly.h"
+#include "polyvec.h"
+
+/* The portable SIMD NTT operates on polynomials in the standard bitreversed
+ * order, so MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER is not set. */
+
+#define MLKEM_USE_NATIVE_NTT
+#define MLKEM_USE_NATIVE_INTT
+#define MLKEM_USE_NATIVE_POLY_REDUCE
+#define MLKEM_USE_NATIVE_POLY_TOMONT
+#define MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY_CACHED
+#define MLKEM_USE_NATIVE_POLY_MULCACHE_COMPUTE
+#define MLKEM_USE_NATIVE_POLY_TOBYTES
+#define MLKEM_USE_NATIVE_POLY_FROMBYTES
+
+#define INVNTT_BOUND_NATIVE MLKEM_Q
+#define NTT_BOUND_NATIVE (8 * MLKEM_Q)
+
+static INLINE void ntt_native(poly *data)
+{
+  ntt_portable_simd(data->coeffs, qdata_portable_simd);
+}
+
+static INLINE void intt_native(poly *data)
+{
+  invntt_portable_simd(data->coeffs, qdata_portable_simd);
+}
+
+static INLINE void poly_reduce_native(poly *data)
+{
+  reduce_portable_simd(data->coeffs);
+}
+
+static INLINE void poly_tomont_native(poly *data)
+{
+  tomont_portable_simd(data->coeffs);
+}
+
+static INLINE void poly_mulcache_compute_native(poly_mulcache *x, const poly *y)
+{
+  poly_mulcache_compute_portable_simd(x->coeffs, y->coeffs,
+                                      qdata_portable_simd);
+}
+
+static INLINE void polyvec_basemul_acc_montgomery_cached_native(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache)
+{
+  polyvec_basemul_acc_montgomery_cached_portable_simd(r, a, b, b_cache);
+}
+
+static INLINE void poly_tobytes_native(uint8_t r[MLKEM_POLYBYTES],
+                                       const poly *a)
+{
+  ntttobytes_portable_simd(r, a->coeffs);
+}
+
+static INLINE void poly_frombytes_native(poly *r,
+                                         const uint8_t a[MLKEM_POLYBYTES])
+{
+  nttfrombytes_portable_simd(r->coeffs, a);
+}
+
+#endif /* MLKEM_NATIVE_ARITH_PROFILE_IMPL_H */
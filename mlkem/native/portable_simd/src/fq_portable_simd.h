@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef FQ_PORTABLE_SIMD_H
+#define FQ_PORTABLE_SIMD_H
+
+#include <stdint.h>
+#include <string.h>
+#include "common.h"
+
+/*
+ * 128-bit vectors using the GCC/Clang vector extensions. The compiler
+ * maps them to the SIMD unit of the target (SSE2, NEON, VSX, z/Vector,
+ * RVV, ...), or to scalar code if there is none.
+ *
+ * Vector lanes are only ever loaded from and stored to arrays of the
+ * same element type. The only dependency on the endianness of the target
+ * is the position of the bytes of 16-bit lanes in byte shuffles, see
+ * B16() and SHUFFLE16_U16().
+ */
+
+#if !defined(__GNUC__) || (!defined(__clang__) && __GNUC__ < 9)
+#error The portable SIMD backend requires GCC >= 9 or Clang
+#endif
+
+#if !defined(SYS_LITTLE_ENDIAN) && !defined(SYS_BIG_ENDIAN)
+#error The portable SIMD backend requires the endianness of the target
+#endif
+
+typedef int16_t v8i16 __attribute__((vector_size(16)));
+typedef uint16_t v8u16 __attribute__((vector_size(16)));
+typedef int32_t v4i32 __attribute__((vector_size(16)));
+typedef uint32_t v4u32 __attribute__((vector_size(16)));
+typedef int32_t v8i32 __attribute__((vector_size(32)));
+typedef uint32_t v8u32 __attribute__((vector_size(32)));
+typedef uint8_t v16u8 __attribute__((vector_size(16)));
+
+/*
+ * Two-input shuffles. Indices 0..n-1 select lanes of a, indices n..2n-1
+ * lanes of b. GCC before version 12 only has __builtin_shuffle, which
+ * Clang does not support.
+ */
+#if defined(__clang__)
+#define SHUFFLE8(a, b, i0, i1, i2, i3, i4, i5, i6, i7) \
+  __builtin_shufflevector((a), (b), i0, i1, i2, i3, i4, i5, i6, i7)
+#define SHUFFLE16(a, b, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, \
+                  i12, i13, i14, i15)                                     \
+  __builtin_shufflevector((a), (b), i0, i1, i2, i3, i4, i5, i6, i7, i8,  \
+                          i9, i10, i11, i12, i13, i14, i15)
+#else
+#define SHUFFLE8(a, b, i0, i1, i2, i3, i4, i5, i6, i7) \
+  __builtin_shuffle((a), (b), (v8u16){i0, i1, i2, i3, i4, i5, i6, i7})
+#define SHUFFLE16(a, b, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, \
+                  i12, i13, i14, i15)                                     \
+  __builtin_shuffle((a), (b),                                             \
+                    (v16u8){i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10,  \
+                            i11, i12, i13, i14, i15})
+#endif
+
+/*
+ * B16(j, k) is the index of byte k (0 = least significant) of lane j of
+ * a v8u16 reinterpreted as v16u8. Lane j of (v8u16)SHUFFLE16_U16(a, b,
+ * l0, h0, ..., l7, h7) has least significant byte l_j and most significant
+ * byte h_j.
+ */
+#if defined(SYS_BIG_ENDIAN)
+#define B16(j, k) (2 * (j) + 1 - (k))
+#define SHUFFLE16_U16(a, b, l0, h0, l1, h1, l2, h2, l3, h3, l4, h4, l5, h5, \
+                      l6, h6, l7, h7)                                       \
+  SHUFFLE16(a, b, h0, l0, h1, l1, h2, l2, h3, l3, h4, l4, h5, l5, h6, l6,  \
+            h7, l7)
+#else
+#define B16(j, k) (2 * (j) + (k))
+#define SHUFFLE16_U16(a, b, l0, h0, l1, h1, l2, h2, l3, h3, l4, h4, l5, h5, \
+                      l6, h6, l7, h7)                                       \
+  SHUFFLE16(a, b, l0, h0, l1, h1, l2, h2, l3, h3, l4, h4, l5, h5, l6, h6,  \
+            l7, h7)
+#endif
+
+/* Even and odd lanes of the 16 coefficients in a, b */
+#define EVEN8(a, b) SHUFFLE8(a, b, 0, 2, 4, 6, 8, 10, 12, 14)
+#define ODD8(a, b) SHUFFLE8(a, b, 1, 3, 5, 7, 9, 11, 13, 15)
+/* Inverse of EVEN8/ODD8: the first and second half of the interleaving */
+#define ZIPLO8(a, b) SHUFFLE8(a, b, 0, 8, 1, 9, 2, 10, 3, 11)
+#define ZIPHI8(a, b) SHUFFLE8(a, b, 4, 12, 5, 13, 6, 14, 7, 15)
+
+#define PSIMD_QINV -3327 /* q^-1 mod 2^16 */
+#define PSIMD_V 20159    /* floor(2^26/q + 0.5) */
+
+static INLINE v8i16 load_i16x8(const int16_t *p)
+{
+  v8i16 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static INLINE void store_i16x8(int16_t *p, v8i16 v)
+{
+  memcpy(p, &v, sizeof(v));
+}
+
+static INLINE v8i16 set1_i16x8(int16_t x)
+{
+  return (v8i16){x, x, x, x, x, x, x, x};
+}
+
+/* Low half of the lane-wise product, without signed overflow */
+static INLINE v8i16 mullo_i16x8(v8i16 a, v8i16 b)
+{
+  return (v8i16)((v8u16)a * (v8u16)b);
+}
+
+/*
+ * High half of the lane-wise 32-bit product
+ *
+ * Clang recognizes the widening multiplication as such (e.g. PMULHW,
+ * SQDMULH). GCC computes it in full 32-bit lanes, so there the products
+ * are instead formed in the 32-bit lanes holding pairs of 16-bit lanes:
+ * this is independent of the order of the two halves.
+ */
+static INLINE v8i16 mulhi_i16x8(v8i16 a, v8i16 b)
+{
+#if defined(__clang__)
+  v8i32 t = __builtin_convertvector(a, v8i32) *
+            __builtin_convertvector(b, v8i32);
+  return __builtin_convertvector(t >> 16, v8i16);
+#else
+  v4i32 x = (v4i32)a, y = (v4i32)b;
+  v4i32 lo = (v4i32)((v4u32)x << 16) >> 16;
+  v4i32 hi = x >> 16;
+  lo *= (v4i32)((v4u32)y << 16) >> 16;
+  hi *= y >> 16;
+  return (v8i16)(((v4u32)hi & 0xFFFF0000) | ((v4u32)lo >> 16));
+#endif
+}
+
+/*
+ * Montgomery multiplication a * b * 2^-16 mod q, with output bound
+ * by q in absolute value if b is. btw = b * q^-1 mod 2^16 must be
+ * precomputed.
+ *
+ * The result is bit-identical to fqmul() from the C reference.
+ */
+static INLINE v8i16 fqmul_i16x8(v8i16 a, v8i16 b, v8i16 btw)
+{
+  v8i16 hi = mulhi_i16x8(a, b);
+  v8i16 t = mulhi_i16x8(mullo_i16x8(a, btw), set1_i16x8(MLKEM_Q));
+  return hi - t;
+}
+
+/*
+ * Barrett reduction to the centered range (-q/2, q/2]
+ *
+ * The result is bit-identical to barrett_reduce() from the C reference.
+ */
+static INLINE v8i16 barrett_reduce_i16x8(v8i16 a)
+{
+  v8i16 t = mulhi_i16x8(a, set1_i16x8(PSIMD_V));
+  t = (t + 512) >> 10;
+  return a - mullo_i16x8(t, set1_i16x8(MLKEM_Q));
+}
+
+/* Map (-q, q) to [0, q) */
+static INLINE v8i16 signed_to_unsigned_q_i16x8(v8i16 a)
+{
+  return a + ((a >> 15) & MLKEM_Q);
+}
+
+#endif
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD)
+
+#include <stdint.h>
+#include "arith_native_portable_simd.h"
+#include "consts_portable_simd.h"
+#include "fq_portable_simd.h"
+
+/*
+ * The polynomial is held in 32 vectors of 8 coefficients each.
+ *
+ * Layers 1-5 (len 128, 64, 32, 16, 8) combine entire vectors and use
+ * broadcast twiddles. Layers 6-7 (len 4, 2) combine two vectors V[2m],
+ * V[2m+1] holding 16 consecutive coefficients: before each of those layers,
+ * the pair is transposed at the granularity of the butterfly length, so
+ * that the butterfly again combines the two vectors element-wise. Both
+ * transposes are involutions, and they are undone in reverse order.
+ *
+ * This is the structure of the AVX-512 NTT in native/x86_64, scaled down
+ * to 128-bit vectors. The order of coefficients is the same as for the
+ * C reference NTT. The forward NTT computes the same results as the C
+ * reference; the inverse NTT reduces lazily, see invntt_portable_simd().
+ */
+
+/* Load the broadcast of scalar twiddle i, and its twisted version */
+#define LOAD_SCALAR(z, ztw, qdata, i)                                  \
+  do                                                                   \
+  {                                                                    \
+    (z) = set1_i16x8((qdata)[_PSIMD_ZETAS_L12345 + (i)]);              \
+    (ztw) = set1_i16x8((qdata)[_PSIMD_ZETAS_L12345 + 32 + (i)]);       \
+  } while (0)
+
+static INLINE void ct_butterfly(v8i16 *a, v8i16 *b, v8i16 z, v8i16 ztw)
+{
+  v8i16 t = fqmul_i16x8(*b, z, ztw);
+  *b = *a - t;
+  *a = *a + t;
+}
+
+/* Gentleman-Sande butterfly without reduction of the sum */
+static INLINE void gs_butterfly(v8i16 *a, v8i16 *b, v8i16 z, v8i16 ztw)
+{
+  v8i16 t = *a;
+  *a = t + *b;
+  *b = fqmul_i16x8(*b - t, z, ztw);
+}
+
+/* Gentleman-Sande butterfly with Barrett reduction of the sum */
+static INLINE void gs_butterfly_reduce(v8i16 *a, v8i16 *b, v8i16 z,
+                                       v8i16 ztw)
+{
+  gs_butterfly(a, b, z, ztw);
+  *a = barrett_reduce_i16x8(*a);
+}
+
+/* Butterflies on a pair of vectors, with twiddle vector at zv */
+static INLINE void ct_butterfly_vec(v8i16 *a, v8i16 *b, const int16_t *zv)
+{
+  ct_butterfly(a, b, load_i16x8(zv + 8), load_i16x8(zv));
+}
+
+static INLINE void gs_butterfly_vec(v8i16 *a, v8i16 *b, const int16_t *zv)
+{
+  gs_butterfly(a, b, load_i16x8(zv + 8), load_i16x8(zv));
+}
+
+/* Swap the upper 64 bits of *x with the lower 64 bits of *y */
+static INLINE void transpose64(v8i16 *x, v8i16 *y)
+{
+  v8i16 a = *x, b = *y;
+  *x = SHUFFLE8(a, b, 0, 1, 2, 3, 8, 9, 10, 11);
+  *y = SHUFFLE8(a, b, 4, 5, 6, 7, 12, 13, 14, 15);
+}
+
+/* Transpose 2x2 blocks of 32-bit lanes within each 64-bit lane */
+static INLINE void transpose32(v8i16 *x, v8i16 *y)
+{
+  v8i16 a = *x, b = *y;
+  *x = SHUFFLE8(a, b, 0, 1, 8, 9, 4, 5, 12, 13);
+  *y = SHUFFLE8(a, b, 2, 3, 10, 11, 6, 7, 14, 15);
+}
+
+void ntt_portable_simd(int16_t *r, const int16_t *qdata)
+{
+  const int16_t *zm = qdata + _PSIMD_ZETAS_L67;
+  v8i16 v[32], z, ztw;
+  unsigned int i, j, m, len;
+
+  for (i = 0; i < 32; i++)
+  {
+    v[i] = load_i16x8(r + 8 * i);
+  }
+
+  /* Layers 1-5: the k-th block of 2 * len vectors uses zetas[2^l + k] */
+  for (len = 16, m = 1; len > 0; len >>= 1, m <<= 1)
+  {
+    for (i = 0; i < m; i++)
+    {
+      LOAD_SCALAR(z, ztw, qdata, m + i);
+      for (j = 2 * len * i; j < 2 * len * i + len; j++)
+      {
+        ct_butterfly(&v[j], &v[j + len], z, ztw);
+      }
+    }
+  }
+
+  /* Layers 6-7 */
+  for (m = 0; m < 16; m++)
+  {
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 32 * m + 0);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 32 * m + 16);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+  }
+
+  for (i = 0; i < 32; i++)
+  {
+    store_i16x8(r + 8 * i, v[i]);
+  }
+}
+
+void invntt_portable_simd(int16_t *r, const int16_t *qdata)
+{
+  /* f = mont^2/128 = 1441, and its twisted version */
+  const v8i16 f = set1_i16x8(1441);
+  const v8i16 ftw = set1_i16x8(-10079);
+  const int16_t *zm = qdata + _PSIMD_ZETAS_INV_L76;
+  v8i16 v[32], z, ztw;
+  unsigned int i, j, k, m, len;
+
+  /*
+   * Differences of the Gentleman-Sande butterflies are reduced by the
+   * Montgomery multiplication and are bound by q. Sums double in size
+   * every layer, so they are only reduced in layers 5 and 1:
+   *
+   * After scaling by f, all coefficients are bound by q. Sums are bound
+   * by 2q, 4q and 8q after layers 7, 6 and 5, then by q/2 after Barrett
+   * reduction, and by q, 2q and 4q after layers 4, 3 and 2. Finally,
+   * sums are Barrett-reduced in layer 1, so the output is bound by q.
+   */
+
+  /* Scale by f as in the C reference */
+  for (i = 0; i < 32; i++)
+  {
+    v[i] = fqmul_i16x8(load_i16x8(r + 8 * i), f, ftw);
+  }
+
+  /* Layers 7-6 */
+  for (m = 0; m < 16; m++)
+  {
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    gs_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 32 * m + 0);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    gs_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 32 * m + 16);
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+  }
+
+  /* Layers 5-1: the i-th block of 2 * len vectors uses zetas[k - i],
+   * where k = 2^l - 1 for layer l */
+  for (len = 1, k = 31; len <= 16; len <<= 1, k >>= 1)
+  {
+    for (i = 0; i < 16 / len; i++)
+    {
+      LOAD_SCALAR(z, ztw, qdata, k - i);
+      for (j = 2 * len * i; j < 2 * len * i + len; j++)
+      {
+        if (len == 1 || len == 16)
+        {
+          gs_butterfly_reduce(&v[j], &v[j + len], z, ztw);
+        }
+        else
+        {
+          gs_butterfly(&v[j], &v[j + len], z, ztw);
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < 32; i++)
+  {
+    store_i16x8(r + 8 * i, v[i]);
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_ntt_portable_simd MLKEM_NAMESPACE(empty_cu_ntt_portable_simd)
+int empty_cu_ntt_portable_simd;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
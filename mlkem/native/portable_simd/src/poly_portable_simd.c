@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD)
+
+#include <stdint.h>
+#include <string.h>
+#include "arith_native_portable_simd.h"
+#include "consts_portable_simd.h"
+#include "fq_portable_simd.h"
+
+void reduce_portable_simd(int16_t *r)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_N / 8; i++)
+  {
+    v8i16 t = barrett_reduce_i16x8(load_i16x8(r + 8 * i));
+    store_i16x8(r + 8 * i, signed_to_unsigned_q_i16x8(t));
+  }
+}
+
+void tomont_portable_simd(int16_t *r)
+{
+  /* f = 2^32 mod q = 1353, and its twisted version */
+  const v8i16 f = set1_i16x8(1353);
+  const v8i16 ftw = set1_i16x8(20553);
+  unsigned int i;
+  for (i = 0; i < MLKEM_N / 8; i++)
+  {
+    store_i16x8(r + 8 * i, fqmul_i16x8(load_i16x8(r + 8 * i), f, ftw));
+  }
+}
+
+void poly_mulcache_compute_portable_simd(int16_t *x, const int16_t *a,
+                                         const int16_t *qdata)
+{
+  unsigned int i;
+  const int16_t *zv = qdata + _PSIMD_ZETAS_MULCACHE;
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    /* The mulcache holds zeta * a1 or -zeta * a1 for every pair (a0, a1) */
+    v8i16 t = ODD8(load_i16x8(a + 16 * i), load_i16x8(a + 16 * i + 8));
+    t = fqmul_i16x8(t, load_i16x8(zv + 16 * i + 8), load_i16x8(zv + 16 * i));
+    store_i16x8(x + 8 * i, t);
+  }
+}
+
+/* Montgomery reduction of 32-bit lanes, as montgomery_reduce() */
+static INLINE v8i16 montgomery_reduce_i32x8(v8i32 a)
+{
+  /* t = a * q^-1 mod 2^16, as signed canonical representative */
+  v8u32 u = (v8u32)a * (uint32_t)PSIMD_QINV;
+  v8i32 t = __builtin_convertvector(
+      (v8i16)__builtin_convertvector(u, v8u16), v8i32);
+  return __builtin_convertvector((a - t * MLKEM_Q) >> 16, v8i16);
+}
+
+void polyvec_basemul_acc_montgomery_cached_portable_simd(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache)
+{
+  unsigned int i, k;
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    v8i32 acc0 = {0}, acc1 = {0};
+
+    /* Products are summed over all k before the Montgomery reduction;
+     * with |a| < 4096, the sums stay below 2 * MLKEM_K * 2^12 * 2^15. */
+    for (k = 0; k < MLKEM_K; k++)
+    {
+      const int16_t *x = a->vec[k].coeffs + 16 * i;
+      const int16_t *y = b->vec[k].coeffs + 16 * i;
+      v8i16 x0 = load_i16x8(x), x1 = load_i16x8(x + 8);
+      v8i16 y0 = load_i16x8(y), y1 = load_i16x8(y + 8);
+      v8i32 a0 = __builtin_convertvector(EVEN8(x0, x1), v8i32);
+      v8i32 a1 = __builtin_convertvector(ODD8(x0, x1), v8i32);
+      v8i32 b0 = __builtin_convertvector(EVEN8(y0, y1), v8i32);
+      v8i32 b1 = __builtin_convertvector(ODD8(y0, y1), v8i32);
+      v8i32 c = __builtin_convertvector(
+          load_i16x8(b_cache->vec[k].coeffs + 8 * i), v8i32);
+
+      acc0 += a0 * b0 + a1 * c;
+      acc1 += a0 * b1 + a1 * b0;
+    }
+
+    {
+      v8i16 r0 = montgomery_reduce_i32x8(acc0);
+      v8i16 r1 = montgomery_reduce_i32x8(acc1);
+      store_i16x8(r->coeffs + 16 * i, ZIPLO8(r0, r1));
+      store_i16x8(r->coeffs + 16 * i + 8, ZIPHI8(r0, r1));
+    }
+  }
+}
+
+/*
+ * Packs 16 coefficients in [0, q) from a0, a1 into 24 bytes.
+ *
+ * Each pair (e, o) of coefficients is combined into the 16-bit lanes
+ * e | o << 12 and o >> 4, whose bytes are then interleaved.
+ */
+static INLINE void pack12_i16x8(uint8_t r[24], v8i16 a0, v8i16 a1)
+{
+  v8u16 e = (v8u16)EVEN8(a0, a1);
+  v8u16 o = (v8u16)ODD8(a0, a1);
+  v16u8 lo = (v16u8)(e | (o << 12));
+  v16u8 hi = (v16u8)(o >> 4);
+  v16u8 t;
+
+  /* Byte 3j + l is byte l of lane j of lo (l < 2) or byte 0 of lane j
+   * of hi (l = 2); hi is indexed from 16. */
+  t = SHUFFLE16(lo, hi, B16(0, 0), B16(0, 1), 16 + B16(0, 0), B16(1, 0),
+                B16(1, 1), 16 + B16(1, 0), B16(2, 0), B16(2, 1),
+                16 + B16(2, 0), B16(3, 0), B16(3, 1), 16 + B16(3, 0),
+                B16(4, 0), B16(4, 1), 16 + B16(4, 0), B16(5, 0));
+  memcpy(r, &t, 16);
+  t = SHUFFLE16(lo, hi, B16(5, 1), 16 + B16(5, 0), B16(6, 0), B16(6, 1),
+                16 + B16(6, 0), B16(7, 0), B16(7, 1), 16 + B16(7, 0), 0, 0,
+                0, 0, 0, 0, 0, 0);
+  memcpy(r + 16, &t, 8);
+}
+
+void ntttobytes_portable_simd(uint8_t *r, const int16_t *a)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    pack12_i16x8(r + 24 * i, load_i16x8(a + 16 * i),
+                 load_i16x8(a + 16 * i + 8));
+  }
+}
+
+void nttfrombytes_portable_simd(int16_t *r, const uint8_t *a)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    v16u8 x, y;
+    v8u16 w0, w1, e, o;
+
+    /* Bytes 0..15 and 8..23 of the 24 bytes for 16 coefficients, so
+     * byte p >= 16 is lane p + 8 of (x, y) */
+    memcpy(&x, a + 24 * i, 16);
+    memcpy(&y, a + 24 * i + 8, 16);
+
+    /* Lane j of w0 is bytes 3j, 3j + 1; lane j of w1 is bytes 3j + 1,
+     * 3j + 2, each in little endian order */
+    w0 = (v8u16)SHUFFLE16_U16(x, y, 0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 15, 24,
+                              26, 27, 29, 30);
+    w1 = (v8u16)SHUFFLE16_U16(x, y, 1, 2, 4, 5, 7, 8, 10, 11, 13, 14, 24,
+                              25, 27, 28, 30, 31);
+
+    e = w0 & 0xFFF;
+    o = w1 >> 4;
+    store_i16x8(r + 16 * i, (v8i16)ZIPLO8(e, o));
+    store_i16x8(r + 16 * i + 8, (v8i16)ZIPHI8(e, o));
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_poly_portable_simd MLKEM_NAMESPACE(empty_cu_poly_portable_simd)
+int empty_cu_poly_portable_simd;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
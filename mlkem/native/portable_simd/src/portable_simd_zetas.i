@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WARNING: This file is auto-generated from scripts/autogenerate_files.py
+ *          Do not modify it directly.
+ */
+
+/*
+ * Table of zeta values used in the portable SIMD NTTs
+ * See autogenerate_files.py for details.
+ */
+
+-1044, -758, -359, -1517, 1493, 1422, 287, 202, -171, 622, 1577, 182, 962,
+    -1202, -1474, 1468, 573, -1325, 264, 383, -829, 1458, -1602, -130, -681,
+    1017, 732, 608, -1542, 411, -205, -1571, -20, 31498, 14745, 787, 13525,
+    -12402, 28191, -16694, -20907, 27758, -3799, -15690, 10690, 1358, -11202,
+    31164, -5827, 17363, -26360, -29057, 5571, -1102, 21438, -26242, -28073,
+    24313, -10532, 8800, 18426, 8859, 26675, -16163, -5689, -5689, -5689, -5689,
+    -6516, -6516, -6516, -6516, 1223, 1223, 1223, 1223, 652, 652, 652, 652,
+    -335, -335, 11182, 11182, -11477, -11477, 13387, 13387, -1103, -1103, 430,
+    430, 555, 555, 843, 843, 1496, 1496, 1496, 1496, 30967, 30967, 30967, 30967,
+    -552, -552, -552, -552, 1015, 1015, 1015, 1015, -32227, -32227, -14233,
+    -14233, 20494, 20494, -21655, -21655, -1251, -1251, 871, 871, 1550, 1550,
+    105, 105, -23565, -23565, -23565, -23565, 20179, 20179, 20179, 20179, -1293,
+    -1293, -1293, -1293, 1491, 1491, 1491, 1491, -27738, -27738, 13131, 13131,
+    945, 945, -4587, -4587, 422, 422, 587, 587, 177, 177, -235, -235, 20710,
+    20710, 20710, 20710, 25080, 25080, 25080, 25080, -282, -282, -282, -282,
+    -1544, -1544, -1544, -1544, -14883, -14883, 23092, 23092, 6182, 6182, 5493,
+    5493, -291, -291, -460, -460, 1574, 1574, 1653, 1653, -12796, -12796,
+    -12796, -12796, 26616, 26616, 26616, 26616, 516, 516, 516, 516, -8, -8, -8,
+    -8, 32010, 32010, -32502, -32502, 10631, 10631, 30317, 30317, -246, -246,
+    778, 778, 1159, 1159, -147, -147, 16064, 16064, 16064, 16064, -12442,
+    -12442, -12442, -12442, -320, -320, -320, -320, -666, -666, -666, -666,
+    29175, 29175, -18741, -18741, -28762, -28762, 12639, 12639, -777, -777,
+    1483, 1483, -602, -602, 1119, 1119, 9134, 9134, 9134, 9134, -650, -650,
+    -650, -650, -1618, -1618, -1618, -1618, -1162, -1162, -1162, -1162, -18486,
+    -18486, 20100, 20100, 17560, 17560, 18525, 18525, -1590, -1590, 644, 644,
+    -872, -872, 349, 349, -25986, -25986, -25986, -25986, 27837, 27837, 27837,
+    27837, 126, 126, 126, 126, 1469, 1469, 1469, 1469, -14430, -14430, 19529,
+    19529, -5276, -5276, -12619, -12619, 418, 418, 329, 329, -156, -156, -75,
+    -75, 19883, 19883, 19883, 19883, -28250, -28250, -28250, -28250, -853, -853,
+    -853, -853, -90, -90, -90, -90, -31183, -31183, 20297, 20297, 25435, 25435,
+    2146, 2146, 817, 817, 1097, 1097, 603, 603, 610, 610, -15887, -15887,
+    -15887, -15887, -8898, -8898, -8898, -8898, -271, -271, -271, -271, 830,
+    830, 830, 830, -7382, -7382, 15355, 15355, 24391, 24391, -32384, -32384,
+    1322, 1322, -1285, -1285, -1465, -1465, 384, 384, -28309, -28309, -28309,
+    -28309, 9075, 9075, 9075, 9075, 107, 107, 107, 107, -1421, -1421, -1421,
+    -1421, -20927, -20927, -6280, -6280, 10946, 10946, -14903, -14903, -1215,
+    -1215, -136, -136, 1218, 1218, -1335, -1335, -30199, -30199, -30199, -30199,
+    18249, 18249, 18249, 18249, -247, -247, -247, -247, -951, -951, -951, -951,
+    24214, 24214, -11044, -11044, 16989, 16989, 14469, 14469, -874, -874, 220,
+    220, -1187, -1187, -1659, -1659, 13426, 13426, 13426, 13426, 14017, 14017,
+    14017, 14017, -398, -398, -398, -398, 961, 961, 961, 961, 10335, 10335,
+    -21498, -21498, -7934, -7934, -20198, -20198, -1185, -1185, -1530, -1530,
+    -1278, -1278, 794, 794, -29156, -29156, -29156, -29156, -12757, -12757,
+    -12757, -12757, -1508, -1508, -1508, -1508, -725, -725, -725, -725, -22502,
+    -22502, 23210, 23210, 10906, 10906, -17442, -17442, -1510, -1510, -854,
+    -854, -870, -870, 478, 478, 16832, 16832, 16832, 16832, 4311, 4311, 4311,
+    4311, 448, 448, 448, 448, -1065, -1065, -1065, -1065, 31636, 31636, -23860,
+    -23860, 28644, 28644, -20257, -20257, -108, -108, -308, -308, 996, 996, 991,
+    991, -24155, -24155, -24155, -24155, -17915, -17915, -17915, -17915, 677,
+    677, 677, 677, -1275, -1275, -1275, -1275, 23998, 23998, 7756, 7756, -17422,
+    -17422, 23132, 23132, 958, 958, -1460, -1460, 1522, 1522, 1628, 1628, 23132,
+    23132, -17422, -17422, 7756, 7756, 23998, 23998, 1628, 1628, 1522, 1522,
+    -1460, -1460, 958, 958, -17915, -17915, -17915, -17915, -24155, -24155,
+    -24155, -24155, -1275, -1275, -1275, -1275, 677, 677, 677, 677, -20257,
+    -20257, 28644, 28644, -23860, -23860, 31636, 31636, 991, 991, 996, 996,
+    -308, -308, -108, -108, 4311, 4311, 4311, 4311, 16832, 16832, 16832, 16832,
+    -1065, -1065, -1065, -1065, 448, 448, 448, 448, -17442, -17442, 10906,
+    10906, 23210, 23210, -22502, -22502, 478, 478, -870, -870, -854, -854,
+    -1510, -1510, -12757, -12757, -12757, -12757, -29156, -29156, -29156,
+    -29156, -725, -725, -725, -725, -1508, -1508, -1508, -1508, -20198, -20198,
+    -7934, -7934, -21498, -21498, 10335, 10335, 794, 794, -1278, -1278, -1530,
+    -1530, -1185, -1185, 14017, 14017, 14017, 14017, 13426, 13426, 13426, 13426,
+    961, 961, 961, 961, -398, -398, -398, -398, 14469, 14469, 16989, 16989,
+    -11044, -11044, 24214, 24214, -1659, -1659, -1187, -1187, 220, 220, -874,
+    -874, 18249, 18249, 18249, 18249, -30199, -30199, -30199, -30199, -951,
+    -951, -951, -951, -247, -247, -247, -247, -14903, -14903, 10946, 10946,
+    -6280, -6280, -20927, -20927, -1335, -1335, 1218, 1218, -136, -136, -1215,
+    -1215, 9075, 9075, 9075, 9075, -28309, -28309, -28309, -28309, -1421, -1421,
+    -1421, -1421, 107, 107, 107, 107, -32384, -32384, 24391, 24391, 15355,
+    15355, -7382, -7382, 384, 384, -1465, -1465, -1285, -1285, 1322, 1322,
+    -8898, -8898, -8898, -8898, -15887, -15887, -15887, -15887, 830, 830, 830,
+    830, -271, -271, -271, -271, 2146, 2146, 25435, 25435, 20297, 20297, -31183,
+    -31183, 610, 610, 603, 603, 1097, 1097, 817, 817, -28250, -28250, -28250,
+    -28250, 19883, 19883, 19883, 19883, -90, -90, -90, -90, -853, -853, -853,
+    -853, -12619, -12619, -5276, -5276, 19529, 19529, -14430, -14430, -75, -75,
+    -156, -156, 329, 329, 418, 418, 27837, 27837, 27837, 27837, -25986, -25986,
+    -25986, -25986, 1469, 1469, 1469, 1469, 126, 126, 126, 126, 18525, 18525,
+    17560, 17560, 20100, 20100, -18486, -18486, 349, 349, -872, -872, 644, 644,
+    -1590, -1590, -650, -650, -650, -650, 9134, 9134, 9134, 9134, -1162, -1162,
+    -1162, -1162, -1618, -1618, -1618, -1618, 12639, 12639, -28762, -28762,
+    -18741, -18741, 29175, 29175, 1119, 1119, -602, -602, 1483, 1483, -777,
+    -777, -12442, -12442, -12442, -12442, 16064, 16064, 16064, 16064, -666,
+    -666, -666, -666, -320, -320, -320, -320, 30317, 30317, 10631, 10631,
+    -32502, -32502, 32010, 32010, -147, -147, 1159, 1159, 778, 778, -246, -246,
+    26616, 26616, 26616, 26616, -12796, -12796, -12796, -12796, -8, -8, -8, -8,
+    516, 516, 516, 516, 5493, 5493, 6182, 6182, 23092, 23092, -14883, -14883,
+    1653, 1653, 1574, 1574, -460, -460, -291, -291, 25080, 25080, 25080, 25080,
+    20710, 20710, 20710, 20710, -1544, -1544, -1544, -1544, -282, -282, -282,
+    -282, -4587, -4587, 945, 945, 13131, 13131, -27738, -27738, -235, -235, 177,
+    177, 587, 587, 422, 422, 20179, 20179, 20179, 20179, -23565, -23565, -23565,
+    -23565, 1491, 1491, 1491, 1491, -1293, -1293, -1293, -1293, -21655, -21655,
+    20494, 20494, -14233, -14233, -32227, -32227, 105, 105, 1550, 1550, 871,
+    871, -1251, -1251, 30967, 30967, 30967, 30967, 1496, 1496, 1496, 1496, 1015,
+    1015, 1015, 1015, -552, -552, -552, -552, 13387, 13387, -11477, -11477,
+    11182, 11182, -335, -335, 843, 843, 555, 555, 430, 430, -1103, -1103, -6516,
+    -6516, -6516, -6516, -5689, -5689, -5689, -5689, 652, 652, 652, 652, 1223,
+    1223, 1223, 1223, -335, 335, 11182, -11182, -11477, 11477, 13387, -13387,
+    -1103, 1103, 430, -430, 555, -555, 843, -843, -32227, 32227, -14233, 14233,
+    20494, -20494, -21655, 21655, -1251, 1251, 871, -871, 1550, -1550, 105,
+    -105, -27738, 27738, 13131, -13131, 945, -945, -4587, 4587, 422, -422, 587,
+    -587, 177, -177, -235, 235, -14883, 14883, 23092, -23092, 6182, -6182, 5493,
+    -5493, -291, 291, -460, 460, 1574, -1574, 1653, -1653, 32010, -32010,
+    -32502, 32502, 10631, -10631, 30317, -30317, -246, 246, 778, -778, 1159,
+    -1159, -147, 147, 29175, -29175, -18741, 18741, -28762, 28762, 12639,
+    -12639, -777, 777, 1483, -1483, -602, 602, 1119, -1119, -18486, 18486,
+    20100, -20100, 17560, -17560, 18525, -18525, -1590, 1590, 644, -644, -872,
+    872, 349, -349, -14430, 14430, 19529, -19529, -5276, 5276, -12619, 12619,
+    418, -418, 329, -329, -156, 156, -75, 75, -31183, 31183, 20297, -20297,
+    25435, -25435, 2146, -2146, 817, -817, 1097, -1097, 603, -603, 610, -610,
+    -7382, 7382, 15355, -15355, 24391, -24391, -32384, 32384, 1322, -1322,
+    -1285, 1285, -1465, 1465, 384, -384, -20927, 20927, -6280, 6280, 10946,
+    -10946, -14903, 14903, -1215, 1215, -136, 136, 1218, -1218, -1335, 1335,
+    24214, -24214, -11044, 11044, 16989, -16989, 14469, -14469, -874, 874, 220,
+    -220, -1187, 1187, -1659, 1659, 10335, -10335, -21498, 21498, -7934, 7934,
+    -20198, 20198, -1185, 1185, -1530, 1530, -1278, 1278, 794, -794, -22502,
+    22502, 23210, -23210, 10906, -10906, -17442, 17442, -1510, 1510, -854, 854,
+    -870, 870, 478, -478, 31636, -31636, -23860, 23860, 28644, -28644, -20257,
+    20257, -108, 108, -308, 308, 996, -996, 991, -991, 23998, -23998, 7756,
+    -7756, -17422, 17422, 23132, -23132, 958, -958, -1460, 1460, 1522, -1522,
+    1628, -1628,
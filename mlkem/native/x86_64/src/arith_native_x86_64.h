@@ -13,12 +13,9 @@
 #include "fips202.h"
 #include "polyvec.h"
 
-#define REJ_UNIFORM_AVX_NBLOCKS \
-  ((12 * MLKEM_N / 8 * (1 << 12) / MLKEM_Q + SHAKE128_RATE) / SHAKE128_RATE)
-#define REJ_UNIFORM_AVX_BUFLEN (REJ_UNIFORM_AVX_NBLOCKS * SHAKE128_RATE)
-
 #define rej_uniform_avx2 MLKEM_NAMESPACE(rej_uniform_avx2)
-unsigned int rej_uniform_avx2(int16_t *r, const uint8_t *buf);
+unsigned int rej_uniform_avx2(int16_t *r, unsigned int len, const uint8_t *buf,
+                              unsigned int buflen);
 
 #define rej_uniform_table MLKEM_NAMESPACE(rej_uniform_table)
 extern const uint8_t rej_uniform_table[256][8];
@@ -42,11 +39,10 @@ void reduce_avx2(__m256i *r, const __m256i *qdata);
 void basemul_avx2(__m256i *r, const __m256i *a, const __m256i *b,
                   const __m256i *qdata);
 
-#define polyvec_basemul_acc_montgomery_cached_avx2 \
-  MLKEM_NAMESPACE(polyvec_basemul_acc_montgomery_cached_avx2)
-void polyvec_basemul_acc_montgomery_cached_avx2(
-    poly *r, const polyvec *a, const polyvec *b,
-    const polyvec_mulcache *b_cache);
+#define polyvec_basemul_acc_montgomery_avx2 \
+  MLKEM_NAMESPACE(polyvec_basemul_acc_montgomery_avx2)
+void polyvec_basemul_acc_montgomery_avx2(poly *r, const polyvec *a,
+                                         const polyvec *b);
 
 #define ntttobytes_avx2 MLKEM_NAMESPACE(ntttobytes_avx2)
 void ntttobytes_avx2(uint8_t *r, const __m256i *a, const __m256i *qdata);
@@ -57,4 +53,63 @@ void nttfrombytes_avx2(__m256i *r, const uint8_t *a, const __m256i *qdata);
 #define tomont_avx2 MLKEM_NAMESPACE(tomont_avx2)
 void tomont_avx2(__m256i *r, const __m256i *qdata);
 
+#define modulus_check_avx2 MLKEM_NAMESPACE(modulus_check_avx2)
+int modulus_check_avx2(const uint8_t *a);
+
+#define poly_compress_d4_avx2 MLKEM_NAMESPACE(poly_compress_d4_avx2)
+void poly_compress_d4_avx2(uint8_t r[128], const __m256i *a);
+
+#define poly_add_reduce_compress_d4_avx2 \
+  MLKEM_NAMESPACE(poly_add_reduce_compress_d4_avx2)
+void poly_add_reduce_compress_d4_avx2(uint8_t r[128], const __m256i *a,
+                                      const __m256i *e, const __m256i *m);
+
+#define poly_decompress_d4_avx2 MLKEM_NAMESPACE(poly_decompress_d4_avx2)
+void poly_decompress_d4_avx2(__m256i *r, const uint8_t a[128]);
+
+#define poly_compress_d5_avx2 MLKEM_NAMESPACE(poly_compress_d5_avx2)
+void poly_compress_d5_avx2(uint8_t r[160], const __m256i *a);
+
+#define poly_add_reduce_compress_d5_avx2 \
+  MLKEM_NAMESPACE(poly_add_reduce_compress_d5_avx2)
+void poly_add_reduce_compress_d5_avx2(uint8_t r[160], const __m256i *a,
+                                      const __m256i *e, const __m256i *m);
+
+#define poly_decompress_d5_avx2 MLKEM_NAMESPACE(poly_decompress_d5_avx2)
+void poly_decompress_d5_avx2(__m256i *r, const uint8_t a[160]);
+
+#define poly_compress_d10_avx2 MLKEM_NAMESPACE(poly_compress_d10_avx2)
+void poly_compress_d10_avx2(uint8_t r[320], const __m256i *a);
+
+#define poly_add_reduce_compress_d10_avx2 \
+  MLKEM_NAMESPACE(poly_add_reduce_compress_d10_avx2)
+void poly_add_reduce_compress_d10_avx2(uint8_t r[320], const __m256i *a,
+                                       const __m256i *e);
+
+#define poly_decompress_d10_avx2 MLKEM_NAMESPACE(poly_decompress_d10_avx2)
+void poly_decompress_d10_avx2(__m256i *r, const uint8_t a[320]);
+
+#define poly_compress_d11_avx2 MLKEM_NAMESPACE(poly_compress_d11_avx2)
+void poly_compress_d11_avx2(uint8_t r[352], const __m256i *a);
+
+#define poly_add_reduce_compress_d11_avx2 \
+  MLKEM_NAMESPACE(poly_add_reduce_compress_d11_avx2)
+void poly_add_reduce_compress_d11_avx2(uint8_t r[352], const __m256i *a,
+                                       const __m256i *e);
+
+#define poly_decompress_d11_avx2 MLKEM_NAMESPACE(poly_decompress_d11_avx2)
+void poly_decompress_d11_avx2(__m256i *r, const uint8_t a[352]);
+
+#define poly_frommsg_avx2 MLKEM_NAMESPACE(poly_frommsg_avx2)
+void poly_frommsg_avx2(__m256i *r, const uint8_t msg[32]);
+
+#define poly_tomsg_avx2 MLKEM_NAMESPACE(poly_tomsg_avx2)
+void poly_tomsg_avx2(uint8_t msg[32], const __m256i *a);
+
+#define poly_cbd2_avx2 MLKEM_NAMESPACE(poly_cbd2_avx2)
+void poly_cbd2_avx2(__m256i *r, const uint8_t buf[128]);
+
+#define poly_cbd3_avx2 MLKEM_NAMESPACE(poly_cbd3_avx2)
+void poly_cbd3_avx2(__m256i *r, const uint8_t buf[192]);
+
 #endif /* MLKEM_X86_64_NATIVE_H */
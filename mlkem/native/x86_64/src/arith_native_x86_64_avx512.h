@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLKEM_X86_64_AVX512_NATIVE_H
+#define MLKEM_X86_64_AVX512_NATIVE_H
+
+#include "common.h"
+
+#include <stdint.h>
+#include "consts_avx512.h"
+#include "polyvec.h"
+
+#define rej_uniform_avx512 MLKEM_NAMESPACE(rej_uniform_avx512)
+unsigned int rej_uniform_avx512(int16_t *r, unsigned int len,
+                                const uint8_t *buf, unsigned int buflen);
+
+#define ntt_avx512 MLKEM_NAMESPACE(ntt_avx512)
+void ntt_avx512(int16_t *r, const int16_t *qdata);
+
+#define invntt_avx512 MLKEM_NAMESPACE(invntt_avx512)
+void invntt_avx512(int16_t *r, const int16_t *qdata);
+
+#define reduce_avx512 MLKEM_NAMESPACE(reduce_avx512)
+void reduce_avx512(int16_t *r);
+
+#define tomont_avx512 MLKEM_NAMESPACE(tomont_avx512)
+void tomont_avx512(int16_t *r);
+
+#define poly_mulcache_compute_avx512 \
+  MLKEM_NAMESPACE(poly_mulcache_compute_avx512)
+void poly_mulcache_compute_avx512(int16_t *x, const int16_t *a,
+                                  const int16_t *qdata);
+
+#define polyvec_basemul_acc_montgomery_cached_avx512 \
+  MLKEM_NAMESPACE(polyvec_basemul_acc_montgomery_cached_avx512)
+void polyvec_basemul_acc_montgomery_cached_avx512(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache);
+
+#define ntttobytes_avx512 MLKEM_NAMESPACE(ntttobytes_avx512)
+void ntttobytes_avx512(uint8_t *r, const int16_t *a);
+
+#define nttfrombytes_avx512 MLKEM_NAMESPACE(nttfrombytes_avx512)
+void nttfrombytes_avx512(int16_t *r, const uint8_t *a);
+
+#define modulus_check_avx512 MLKEM_NAMESPACE(modulus_check_avx512)
+int modulus_check_avx512(const uint8_t *a);
+
+#endif /* MLKEM_X86_64_AVX512_NATIVE_H */
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* ML-KEM arithmetic native profile for AVX-512 */
+
+#ifdef MLKEM_NATIVE_ARITH_PROFILE_IMPL_H
+#error Only one MLKEM_ARITH assembly profile can be defined -- did you include multiple profiles?
+#else
+#define MLKEM_NATIVE_ARITH_PROFILE_IMPL_H
+
+/* The compression, message and CBD kernels are shared with the AVX2
+ * backend */
+#include "arith_native_x86_64.h"
+#include "arith_native_x86_64_avx512.h"
+#include "poly.h"
+#include "polyvec.h"
+
+/* The AVX-512 NTT operates on polynomials in the standard bitreversed
+ * order, so MLKEM_USE_NATIVE_NTT_CUSTOM_ORDER is not set. */
+
+#define MLKEM_USE_NATIVE_REJ_UNIFORM
+#define MLKEM_USE_NATIVE_NTT
+#define MLKEM_USE_NATIVE_INTT
+#define MLKEM_USE_NATIVE_POLY_REDUCE
+#define MLKEM_USE_NATIVE_POLY_TOMONT
+#define MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY_CACHED
+#define MLKEM_USE_NATIVE_POLY_MULCACHE_COMPUTE
+#define MLKEM_USE_NATIVE_POLY_TOBYTES
+#define MLKEM_USE_NATIVE_POLY_FROMBYTES
+#define MLKEM_USE_NATIVE_POLY_MODULUS_CHECK
+#define MLKEM_USE_NATIVE_POLY_COMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_COMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_FROMMSG
+#define MLKEM_USE_NATIVE_POLY_TOMSG
+#define MLKEM_USE_NATIVE_POLY_CBD_ETA1
+#define MLKEM_USE_NATIVE_POLY_CBD_ETA2
+
+#define INVNTT_BOUND_NATIVE MLKEM_Q
+#define NTT_BOUND_NATIVE (8 * MLKEM_Q)
+
+static INLINE int rej_uniform_native(int16_t *r, unsigned int len,
+                                     const uint8_t *buf, unsigned int buflen)
+{
+  return (int)rej_uniform_avx512(r, len, buf, buflen);
+}
+
+static INLINE void ntt_native(poly *data)
+{
+  ntt_avx512(data->coeffs, qdata_avx512);
+}
+
+static INLINE void intt_native(poly *data)
+{
+  invntt_avx512(data->coeffs, qdata_avx512);
+}
+
+static INLINE void poly_reduce_native(poly *data)
+{
+  reduce_avx512(data->coeffs);
+}
+
+static INLINE void poly_tomont_native(poly *data)
+{
+  tomont_avx512(data->coeffs);
+}
+
+static INLINE void poly_mulcache_compute_native(poly_mulcache *x, const poly *y)
+{
+  poly_mulcache_compute_avx512(x->coeffs, y->coeffs, qdata_avx512);
+}
+
+static INLINE void polyvec_basemul_acc_montgomery_cached_native(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache)
+{
+  polyvec_basemul_acc_montgomery_cached_avx512(r, a, b, b_cache);
+}
+
+static INLINE void poly_tobytes_native(uint8_t r[MLKEM_POLYBYTES],
+                                       const poly *a)
+{
+  ntttobytes_avx512(r, a->coeffs);
+}
+
+static INLINE void poly_frombytes_native(poly *r,
+                                         const uint8_t a[MLKEM_POLYBYTES])
+{
+  nttfrombytes_avx512(r->coeffs, a);
+}
+
+static INLINE int poly_modulus_check_native(const uint8_t a[MLKEM_POLYBYTES])
+{
+  return modulus_check_avx512(a);
+}
+
+static INLINE void poly_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a)
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_compress_d11_avx2(r, (const __m256i *)a->coeffs);
+#else
+  poly_compress_d10_avx2(r, (const __m256i *)a->coeffs);
+#endif
+}
+
+static INLINE void poly_decompress_du_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_decompress_d11_avx2((__m256i *)r->coeffs, a);
+#else
+  poly_decompress_d10_avx2((__m256i *)r->coeffs, a);
+#endif
+}
+
+static INLINE void poly_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a)
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_compress_d5_avx2(r, (const __m256i *)a->coeffs);
+#else
+  poly_compress_d4_avx2(r, (const __m256i *)a->coeffs);
+#endif
+}
+
+static INLINE void poly_decompress_dv_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV])
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_decompress_d5_avx2((__m256i *)r->coeffs, a);
+#else
+  poly_decompress_d4_avx2((__m256i *)r->coeffs, a);
+#endif
+}
+
+static INLINE void poly_invntt_add_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], poly *b, const poly *e)
+{
+  invntt_avx512(b->coeffs, qdata_avx512);
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_add_reduce_compress_d11_avx2(r, (const __m256i *)b->coeffs,
+                                    (const __m256i *)e->coeffs);
+#else
+  poly_add_reduce_compress_d10_avx2(r, (const __m256i *)b->coeffs,
+                                    (const __m256i *)e->coeffs);
+#endif
+}
+
+static INLINE void poly_invntt_add_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], poly *a, const poly *e,
+    const poly *m)
+{
+  invntt_avx512(a->coeffs, qdata_avx512);
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_add_reduce_compress_d5_avx2(r, (const __m256i *)a->coeffs,
+                                   (const __m256i *)e->coeffs,
+                                   (const __m256i *)m->coeffs);
+#else
+  poly_add_reduce_compress_d4_avx2(r, (const __m256i *)a->coeffs,
+                                   (const __m256i *)e->coeffs,
+                                   (const __m256i *)m->coeffs);
+#endif
+}
+
+static INLINE void poly_frommsg_native(
+    poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES])
+{
+  poly_frommsg_avx2((__m256i *)r->coeffs, msg);
+}
+
+static INLINE void poly_tomsg_native(uint8_t msg[MLKEM_INDCPA_MSGBYTES],
+                                     const poly *a)
+{
+  poly_tomsg_avx2(msg, (const __m256i *)a->coeffs);
+}
+
+static INLINE void poly_cbd_eta1_native(
+    poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4])
+{
+#if MLKEM_ETA1 == 3
+  poly_cbd3_avx2((__m256i *)r->coeffs, buf);
+#else
+  poly_cbd2_avx2((__m256i *)r->coeffs, buf);
+#endif
+}
+
+static INLINE void poly_cbd_eta2_native(
+    poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4])
+{
+  poly_cbd2_avx2((__m256i *)r->coeffs, buf);
+}
+
+#endif /* MLKEM_NATIVE_ARITH_PROFILE_IMPL_H */
@@ -37,16 +37,12 @@ static void poly_add_avx2(poly *r, const poly *a, const poly *b)
   }
 }
 
-void polyvec_basemul_acc_montgomery_cached_avx2(poly *r, const polyvec *a,
-                                                const polyvec *b,
-                                                const polyvec_mulcache *b_cache)
+void polyvec_basemul_acc_montgomery_avx2(poly *r, const polyvec *a,
+                                         const polyvec *b)
 {
   unsigned int i;
   poly t;
 
-  /* TODO: Use mulcache for AVX2. So far, it is unused. */
-  ((void)b_cache);
-
   /* Coefficient-wise bound of each basemul is 2q.
    * Since we are accumulating at most 4 times, the
    * overall bound is 8q < INT16_MAX. */
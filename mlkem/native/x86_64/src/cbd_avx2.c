@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Implementation from Kyber reference repository
+ * https://github.com/pq-crystals/kyber/blob/main/avx2
+ *
+ * Changes: The input buffer is not assumed to be aligned, and cbd3 does
+ * not read beyond the end of the input, so callers need not pad it.
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT) || \
+    defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+void poly_cbd2_avx2(__m256i *r, const uint8_t buf[128])
+{
+  unsigned int i;
+  __m256i f0, f1, f2, f3;
+  const __m256i mask55 = _mm256_set1_epi32(0x55555555);
+  const __m256i mask33 = _mm256_set1_epi32(0x33333333);
+  const __m256i mask03 = _mm256_set1_epi32(0x03030303);
+  const __m256i mask0F = _mm256_set1_epi32(0x0F0F0F0F);
+
+  /* 64 coefficients, two per input byte, per iteration */
+  for (i = 0; i < MLKEM_N / 64; i++)
+  {
+    f0 = _mm256_loadu_si256((const __m256i *)&buf[32 * i]);
+
+    /* Count the set bits in each 2-bit field */
+    f1 = _mm256_srli_epi16(f0, 1);
+    f0 = _mm256_and_si256(mask55, f0);
+    f1 = _mm256_and_si256(mask55, f1);
+    f0 = _mm256_add_epi8(f0, f1);
+
+    /* a - b + 3 in each nibble */
+    f1 = _mm256_srli_epi16(f0, 2);
+    f0 = _mm256_and_si256(mask33, f0);
+    f1 = _mm256_and_si256(mask33, f1);
+    f0 = _mm256_add_epi8(f0, mask33);
+    f0 = _mm256_sub_epi8(f0, f1);
+
+    /* Split the nibbles into signed bytes */
+    f1 = _mm256_srli_epi16(f0, 4);
+    f0 = _mm256_and_si256(mask0F, f0);
+    f1 = _mm256_and_si256(mask0F, f1);
+    f0 = _mm256_sub_epi8(f0, mask03);
+    f1 = _mm256_sub_epi8(f1, mask03);
+
+    f2 = _mm256_unpacklo_epi8(f0, f1);
+    f3 = _mm256_unpackhi_epi8(f0, f1);
+
+    f0 = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(f2));
+    f1 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(f2, 1));
+    f2 = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(f3));
+    f3 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(f3, 1));
+
+    _mm256_store_si256(&r[4 * i + 0], f0);
+    _mm256_store_si256(&r[4 * i + 1], f2);
+    _mm256_store_si256(&r[4 * i + 2], f1);
+    _mm256_store_si256(&r[4 * i + 3], f3);
+  }
+}
+
+void poly_cbd3_avx2(__m256i *r, const uint8_t buf[192])
+{
+  unsigned int i;
+  __m128i lo, hi;
+  __m256i f0, f1, f2, f3;
+  const __m256i mask249 = _mm256_set1_epi32(0x249249);
+  const __m256i mask6DB = _mm256_set1_epi32(0x6DB6DB);
+  const __m256i mask07 = _mm256_set1_epi32(7);
+  const __m256i mask70 = _mm256_set1_epi32(7 << 16);
+  const __m256i mask3 = _mm256_set1_epi16(3);
+  const __m256i shufbidx =
+      _mm256_set_epi8(-1, 15, 14, 13, -1, 12, 11, 10, -1, 9, 8, 7, -1, 6, 5, 4,
+                      -1, 11, 10, 9, -1, 8, 7, 6, -1, 5, 4, 3, -1, 2, 1, 0);
+
+  /* 32 coefficients from 24 bytes per iteration */
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    /*
+     * Bytes 0..15 into the lower lane and bytes 8..23 into the upper
+     * lane, loading exactly the 24 bytes consumed.
+     */
+    lo = _mm_loadu_si128((const __m128i *)&buf[24 * i]);
+    hi = _mm_loadl_epi64((const __m128i *)&buf[24 * i + 16]);
+    hi = _mm_alignr_epi8(hi, lo, 8);
+    f0 = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    f0 = _mm256_shuffle_epi8(f0, shufbidx);
+
+    /* Count the set bits in each 3-bit field */
+    f1 = _mm256_srli_epi32(f0, 1);
+    f2 = _mm256_srli_epi32(f0, 2);
+    f0 = _mm256_and_si256(mask249, f0);
+    f1 = _mm256_and_si256(mask249, f1);
+    f2 = _mm256_and_si256(mask249, f2);
+    f0 = _mm256_add_epi32(f0, f1);
+    f0 = _mm256_add_epi32(f0, f2);
+
+    /* a - b + 3 in every other 3-bit field */
+    f1 = _mm256_srli_epi32(f0, 3);
+    f0 = _mm256_add_epi32(f0, mask6DB);
+    f0 = _mm256_sub_epi32(f0, f1);
+
+    f1 = _mm256_slli_epi32(f0, 10);
+    f2 = _mm256_srli_epi32(f0, 12);
+    f3 = _mm256_srli_epi32(f0, 2);
+    f0 = _mm256_and_si256(f0, mask07);
+    f1 = _mm256_and_si256(f1, mask70);
+    f2 = _mm256_and_si256(f2, mask07);
+    f3 = _mm256_and_si256(f3, mask70);
+    f0 = _mm256_add_epi16(f0, f1);
+    f1 = _mm256_add_epi16(f2, f3);
+    f0 = _mm256_sub_epi16(f0, mask3);
+    f1 = _mm256_sub_epi16(f1, mask3);
+
+    f2 = _mm256_unpacklo_epi32(f0, f1);
+    f3 = _mm256_unpackhi_epi32(f0, f1);
+
+    f0 = _mm256_permute2x128_si256(f2, f3, 0x20);
+    f1 = _mm256_permute2x128_si256(f2, f3, 0x31);
+
+    _mm256_store_si256(&r[2 * i + 0], f0);
+    _mm256_store_si256(&r[2 * i + 1], f1);
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+         MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_cbd_avx2 MLKEM_NAMESPACE(empty_cu_cbd_avx2)
+int empty_cu_cbd_avx2;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+          MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Implementation from Kyber reference repository
+ * https://github.com/pq-crystals/kyber/blob/main/avx2
+ *
+ * Changes: Constants are set up locally rather than loaded from qdata,
+ * and no function reads or writes beyond the compressed polynomial.
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT) || \
+    defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+#include "arith_native_x86_64.h"
+
+/* round(2^26 / MLKEM_Q), for the Barrett-style division by MLKEM_Q */
+#define COMPRESS_V 20159
+
+/*
+ * Load 16 coefficients from a[i]. If e is given, add e[i] (and m[i], if
+ * given) and reduce the sum to [0, MLKEM_Q) before returning it. This
+ * lets the encryption tail compress u = a + e and v = a + e + m without
+ * separate passes for the addition and the reduction.
+ *
+ * The reduction is exact for all int16_t inputs, so the sums only need
+ * to fit into int16_t.
+ */
+ALWAYS_INLINE
+static INLINE __m256i load_reduced(const __m256i *a, const __m256i *e,
+                                   const __m256i *m, unsigned int i)
+{
+  __m256i f, t;
+  const __m256i q = _mm256_set1_epi16(MLKEM_Q);
+  const __m256i v = _mm256_set1_epi16(COMPRESS_V);
+  const __m256i shift = _mm256_set1_epi16(1 << 5);
+
+  f = _mm256_load_si256(&a[i]);
+  if (e == NULL)
+  {
+    return f;
+  }
+
+  f = _mm256_add_epi16(f, _mm256_load_si256(&e[i]));
+  if (m != NULL)
+  {
+    f = _mm256_add_epi16(f, _mm256_load_si256(&m[i]));
+  }
+
+  /* t = round(f / MLKEM_Q), then f - t * MLKEM_Q is in (-MLKEM_Q, MLKEM_Q) */
+  t = _mm256_mulhi_epi16(f, v);
+  t = _mm256_mulhrs_epi16(t, shift);
+  t = _mm256_mullo_epi16(t, q);
+  f = _mm256_sub_epi16(f, t);
+  /* Conditionally add MLKEM_Q to get the unsigned representative */
+  t = _mm256_and_si256(_mm256_srai_epi16(f, 15), q);
+  return _mm256_add_epi16(f, t);
+}
+
+ALWAYS_INLINE
+static INLINE void compress_d4(uint8_t r[128], const __m256i *a,
+                               const __m256i *e, const __m256i *m)
+{
+  unsigned int i;
+  __m256i f0, f1, f2, f3;
+  const __m256i v = _mm256_set1_epi16(COMPRESS_V);
+  const __m256i shift1 = _mm256_set1_epi16(1 << 9);
+  const __m256i mask = _mm256_set1_epi16(15);
+  const __m256i shift2 = _mm256_set1_epi16((16 << 8) + 1);
+  const __m256i permdidx = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+
+  for (i = 0; i < MLKEM_N / 64; i++)
+  {
+    f0 = load_reduced(a, e, m, 4 * i + 0);
+    f1 = load_reduced(a, e, m, 4 * i + 1);
+    f2 = load_reduced(a, e, m, 4 * i + 2);
+    f3 = load_reduced(a, e, m, 4 * i + 3);
+    f0 = _mm256_mulhi_epi16(f0, v);
+    f1 = _mm256_mulhi_epi16(f1, v);
+    f2 = _mm256_mulhi_epi16(f2, v);
+    f3 = _mm256_mulhi_epi16(f3, v);
+    f0 = _mm256_mulhrs_epi16(f0, shift1);
+    f1 = _mm256_mulhrs_epi16(f1, shift1);
+    f2 = _mm256_mulhrs_epi16(f2, shift1);
+    f3 = _mm256_mulhrs_epi16(f3, shift1);
+    f0 = _mm256_and_si256(f0, mask);
+    f1 = _mm256_and_si256(f1, mask);
+    f2 = _mm256_and_si256(f2, mask);
+    f3 = _mm256_and_si256(f3, mask);
+    f0 = _mm256_packus_epi16(f0, f1);
+    f2 = _mm256_packus_epi16(f2, f3);
+    f0 = _mm256_maddubs_epi16(f0, shift2);
+    f2 = _mm256_maddubs_epi16(f2, shift2);
+    f0 = _mm256_packus_epi16(f0, f2);
+    f0 = _mm256_permutevar8x32_epi32(f0, permdidx);
+    _mm256_storeu_si256((__m256i *)&r[32 * i], f0);
+  }
+}
+
+void poly_compress_d4_avx2(uint8_t r[128], const __m256i *a)
+{
+  compress_d4(r, a, NULL, NULL);
+}
+
+void poly_add_reduce_compress_d4_avx2(uint8_t r[128], const __m256i *a,
+                                      const __m256i *e, const __m256i *m)
+{
+  compress_d4(r, a, e, m);
+}
+
+void poly_decompress_d4_avx2(__m256i *r, const uint8_t a[128])
+{
+  unsigned int i;
+  __m128i t;
+  __m256i f;
+  const __m256i q = _mm256_set1_epi16(MLKEM_Q);
+  const __m256i shufbidx =
+      _mm256_set_epi8(7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3,
+                      3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0);
+  const __m256i mask = _mm256_set1_epi32(0x00F0000F);
+  const __m256i shift = _mm256_set1_epi32((128 << 16) + 2048);
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    t = _mm_loadl_epi64((const __m128i *)&a[8 * i]);
+    f = _mm256_broadcastsi128_si256(t);
+    f = _mm256_shuffle_epi8(f, shufbidx);
+    f = _mm256_and_si256(f, mask);
+    f = _mm256_mullo_epi16(f, shift);
+    f = _mm256_mulhrs_epi16(f, q);
+    _mm256_store_si256(&r[i], f);
+  }
+}
+
+ALWAYS_INLINE
+static INLINE void compress_d5(uint8_t r[160], const __m256i *a,
+                               const __m256i *e, const __m256i *m)
+{
+  unsigned int i;
+  __m256i f0, f1;
+  __m128i t0, t1;
+  const __m256i v = _mm256_set1_epi16(COMPRESS_V);
+  const __m256i shift1 = _mm256_set1_epi16(1 << 10);
+  const __m256i mask = _mm256_set1_epi16(31);
+  const __m256i shift2 = _mm256_set1_epi16((32 << 8) + 1);
+  const __m256i shift3 = _mm256_set1_epi32((1024 << 16) + 1);
+  const __m256i sllvdidx = _mm256_set1_epi64x(12);
+  const __m256i shufbidx =
+      _mm256_set_epi8(8, -1, -1, -1, -1, -1, 4, 3, 2, 1, 0, -1, 12, 11, 10, 9,
+                      -1, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, 4, 3, 2, 1, 0);
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    f0 = load_reduced(a, e, m, 2 * i + 0);
+    f1 = load_reduced(a, e, m, 2 * i + 1);
+    f0 = _mm256_mulhi_epi16(f0, v);
+    f1 = _mm256_mulhi_epi16(f1, v);
+    f0 = _mm256_mulhrs_epi16(f0, shift1);
+    f1 = _mm256_mulhrs_epi16(f1, shift1);
+    f0 = _mm256_and_si256(f0, mask);
+    f1 = _mm256_and_si256(f1, mask);
+    f0 = _mm256_packus_epi16(f0, f1);
+    /* a0 a1 a2 a3 b0 b1 b2 b3 a4 a5 a6 a7 b4 b5 b6 b7 */
+    f0 = _mm256_maddubs_epi16(f0, shift2);
+    /* a0 a1 b0 b1 a2 a3 b2 b3 */
+    f0 = _mm256_madd_epi16(f0, shift3);
+    f0 = _mm256_sllv_epi32(f0, sllvdidx);
+    f0 = _mm256_srlv_epi64(f0, sllvdidx);
+    f0 = _mm256_shuffle_epi8(f0, shufbidx);
+    t0 = _mm256_castsi256_si128(f0);
+    t1 = _mm256_extracti128_si256(f0, 1);
+    t0 = _mm_blendv_epi8(t0, t1, _mm256_castsi256_si128(shufbidx));
+    _mm_storeu_si128((__m128i *)&r[20 * i + 0], t0);
+    memcpy(&r[20 * i + 16], &t1, 4);
+  }
+}
+
+void poly_compress_d5_avx2(uint8_t r[160], const __m256i *a)
+{
+  compress_d5(r, a, NULL, NULL);
+}
+
+void poly_add_reduce_compress_d5_avx2(uint8_t r[160], const __m256i *a,
+                                      const __m256i *e, const __m256i *m)
+{
+  compress_d5(r, a, e, m);
+}
+
+void poly_decompress_d5_avx2(__m256i *r, const uint8_t a[160])
+{
+  unsigned int i;
+  __m128i t;
+  __m256i f;
+  int16_t ti;
+  const __m256i q = _mm256_set1_epi16(MLKEM_Q);
+  const __m256i shufbidx =
+      _mm256_set_epi8(9, 9, 9, 8, 8, 8, 8, 7, 7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4,
+                      3, 3, 3, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0);
+  const __m256i mask =
+      _mm256_set_epi16(248, 1984, 62, 496, 3968, 124, 992, 31, 248, 1984, 62,
+                       496, 3968, 124, 992, 31);
+  const __m256i shift =
+      _mm256_set_epi16(128, 16, 512, 64, 8, 256, 32, 1024, 128, 16, 512, 64, 8,
+                       256, 32, 1024);
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    t = _mm_loadl_epi64((const __m128i *)&a[10 * i + 0]);
+    memcpy(&ti, &a[10 * i + 8], 2);
+    t = _mm_insert_epi16(t, ti, 4);
+    f = _mm256_broadcastsi128_si256(t);
+    f = _mm256_shuffle_epi8(f, shufbidx);
+    f = _mm256_and_si256(f, mask);
+    f = _mm256_mullo_epi16(f, shift);
+    f = _mm256_mulhrs_epi16(f, q);
+    _mm256_store_si256(&r[i], f);
+  }
+}
+
+ALWAYS_INLINE
+static INLINE void compress_d10(uint8_t r[320], const __m256i *a,
+                                const __m256i *e, const __m256i *m)
+{
+  unsigned int i;
+  __m256i f0, f1, f2;
+  __m128i t0, t1;
+  const __m256i v = _mm256_set1_epi16(COMPRESS_V);
+  const __m256i v8 = _mm256_slli_epi16(v, 3);
+  const __m256i off = _mm256_set1_epi16(15);
+  const __m256i shift1 = _mm256_set1_epi16(1 << 12);
+  const __m256i mask = _mm256_set1_epi16(1023);
+  const __m256i shift2 = _mm256_set1_epi64x(
+      (1024LL << 48) + (1LL << 32) + (1024 << 16) + 1);
+  const __m256i sllvdidx = _mm256_set1_epi64x(12);
+  const __m256i shufbidx =
+      _mm256_set_epi8(8, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1, 12, 11, 10, 9,
+                      -1, -1, -1, -1, -1, -1, 12, 11, 10, 9, 8, 4, 3, 2, 1, 0);
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    f0 = load_reduced(a, e, m, i);
+    f1 = _mm256_mullo_epi16(f0, v8);
+    f2 = _mm256_add_epi16(f0, off);
+    f0 = _mm256_slli_epi16(f0, 3);
+    f0 = _mm256_mulhi_epi16(f0, v);
+    f2 = _mm256_sub_epi16(f1, f2);
+    f1 = _mm256_andnot_si256(f1, f2);
+    f1 = _mm256_srli_epi16(f1, 15);
+    f0 = _mm256_sub_epi16(f0, f1);
+    f0 = _mm256_mulhrs_epi16(f0, shift1);
+    f0 = _mm256_and_si256(f0, mask);
+    f0 = _mm256_madd_epi16(f0, shift2);
+    f0 = _mm256_sllv_epi32(f0, sllvdidx);
+    f0 = _mm256_srli_epi64(f0, 12);
+    f0 = _mm256_shuffle_epi8(f0, shufbidx);
+    t0 = _mm256_castsi256_si128(f0);
+    t1 = _mm256_extracti128_si256(f0, 1);
+    t0 = _mm_blend_epi16(t0, t1, 0xE0);
+    _mm_storeu_si128((__m128i *)&r[20 * i + 0], t0);
+    memcpy(&r[20 * i + 16], &t1, 4);
+  }
+}
+
+void poly_compress_d10_avx2(uint8_t r[320], const __m256i *a)
+{
+  compress_d10(r, a, NULL, NULL);
+}
+
+void poly_add_reduce_compress_d10_avx2(uint8_t r[320], const __m256i *a,
+                                       const __m256i *e)
+{
+  compress_d10(r, a, e, NULL);
+}
+
+void poly_decompress_d10_avx2(__m256i *r, const uint8_t a[320])
+{
+  unsigned int i;
+  __m256i f;
+  const __m256i q = _mm256_set1_epi32((MLKEM_Q << 16) + 4 * MLKEM_Q);
+  /*
+   * The lower lane holds bytes 0..15 and the upper lane bytes 4..19 of
+   * each 20-byte block
+   */
+  const __m256i shufbidx =
+      _mm256_set_epi8(15, 14, 14, 13, 13, 12, 12, 11, 10, 9, 9, 8, 8, 7, 7, 6,
+                      9, 8, 8, 7, 7, 6, 6, 5, 4, 3, 3, 2, 2, 1, 1, 0);
+  const __m256i sllvdidx = _mm256_set1_epi64x(4);
+  const __m256i mask = _mm256_set1_epi32((32736 << 16) + 8184);
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    f = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)&a[20 * i]));
+    f = _mm256_inserti128_si256(
+        f, _mm_loadu_si128((const __m128i *)&a[20 * i + 4]), 1);
+    f = _mm256_shuffle_epi8(f, shufbidx);
+    f = _mm256_sllv_epi32(f, sllvdidx);
+    f = _mm256_srli_epi16(f, 1);
+    f = _mm256_and_si256(f, mask);
+    f = _mm256_mulhrs_epi16(f, q);
+    _mm256_store_si256(&r[i], f);
+  }
+}
+
+ALWAYS_INLINE
+static INLINE void compress_d11(uint8_t r[352], const __m256i *a,
+                                const __m256i *e, const __m256i *m)
+{
+  unsigned int i;
+  __m256i f0, f1, f2;
+  __m128i t0, t1;
+  const __m256i v = _mm256_set1_epi16(COMPRESS_V);
+  const __m256i v8 = _mm256_slli_epi16(v, 3);
+  const __m256i off = _mm256_set1_epi16(36);
+  const __m256i shift1 = _mm256_set1_epi16(1 << 13);
+  const __m256i mask = _mm256_set1_epi16(2047);
+  const __m256i shift2 = _mm256_set1_epi64x(
+      (2048LL << 48) + (1LL << 32) + (2048 << 16) + 1);
+  const __m256i sllvdidx = _mm256_set1_epi64x(10);
+  const __m256i srlvqidx = _mm256_set_epi64x(30, 10, 30, 10);
+  const __m256i shufbidx =
+      _mm256_set_epi8(4, 3, 2, 1, 0, 0, -1, -1, -1, -1, 10, 9, 8, 7, 6, 5, -1,
+                      -1, -1, -1, -1, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    f0 = load_reduced(a, e, m, i);
+    f1 = _mm256_mullo_epi16(f0, v8);
+    f2 = _mm256_add_epi16(f0, off);
+    f0 = _mm256_slli_epi16(f0, 3);
+    f0 = _mm256_mulhi_epi16(f0, v);
+    f2 = _mm256_sub_epi16(f1, f2);
+    f1 = _mm256_andnot_si256(f1, f2);
+    f1 = _mm256_srli_epi16(f1, 15);
+    f0 = _mm256_sub_epi16(f0, f1);
+    f0 = _mm256_mulhrs_epi16(f0, shift1);
+    f0 = _mm256_and_si256(f0, mask);
+    f0 = _mm256_madd_epi16(f0, shift2);
+    f0 = _mm256_sllv_epi32(f0, sllvdidx);
+    f1 = _mm256_bsrli_epi128(f0, 8);
+    f0 = _mm256_srlv_epi64(f0, srlvqidx);
+    f1 = _mm256_slli_epi64(f1, 34);
+    f0 = _mm256_add_epi64(f0, f1);
+    f0 = _mm256_shuffle_epi8(f0, shufbidx);
+    t0 = _mm256_castsi256_si128(f0);
+    t1 = _mm256_extracti128_si256(f0, 1);
+    t0 = _mm_blendv_epi8(t0, t1, _mm256_castsi256_si128(shufbidx));
+    _mm_storeu_si128((__m128i *)&r[22 * i + 0], t0);
+    /* 6 bytes rather than 8, so the last store stays within r */
+    memcpy(&r[22 * i + 16], &t1, 6);
+  }
+}
+
+void poly_compress_d11_avx2(uint8_t r[352], const __m256i *a)
+{
+  compress_d11(r, a, NULL, NULL);
+}
+
+void poly_add_reduce_compress_d11_avx2(uint8_t r[352], const __m256i *a,
+                                       const __m256i *e)
+{
+  compress_d11(r, a, e, NULL);
+}
+
+void poly_decompress_d11_avx2(__m256i *r, const uint8_t a[352])
+{
+  unsigned int i;
+  __m256i f;
+  const __m256i q = _mm256_set1_epi16(MLKEM_Q);
+  const __m256i shufbidx =
+      _mm256_set_epi8(13, 12, 12, 11, 10, 9, 9, 8, 8, 7, 6, 5, 5, 4, 4, 3, 10,
+                      9, 9, 8, 7, 6, 6, 5, 5, 4, 3, 2, 2, 1, 1, 0);
+  const __m256i srlvdidx = _mm256_set_epi32(0, 0, 1, 0, 0, 0, 1, 0);
+  const __m256i srlvqidx = _mm256_set_epi64x(2, 0, 2, 0);
+  const __m256i shift =
+      _mm256_set_epi16(4, 32, 1, 8, 32, 1, 4, 32, 4, 32, 1, 8, 32, 1, 4, 32);
+  const __m256i mask = _mm256_set1_epi16(32752);
+  /* Zero-padded copy of the last 22 bytes, see below */
+  uint8_t tail[32] = {0};
+
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    /*
+     * Each iteration consumes 22 bytes but loads 32; only the first 24
+     * are used. For the last iteration, load from a padded copy rather
+     * than reading beyond the input.
+     */
+    if (i < MLKEM_N / 16 - 1)
+    {
+      f = _mm256_loadu_si256((const __m256i *)&a[22 * i]);
+    }
+    else
+    {
+      memcpy(tail, &a[22 * i], 22);
+      f = _mm256_loadu_si256((const __m256i *)tail);
+    }
+    f = _mm256_permute4x64_epi64(f, 0x94);
+    f = _mm256_shuffle_epi8(f, shufbidx);
+    f = _mm256_srlv_epi32(f, srlvdidx);
+    f = _mm256_srlv_epi64(f, srlvqidx);
+    f = _mm256_mullo_epi16(f, shift);
+    f = _mm256_srli_epi16(f, 1);
+    f = _mm256_and_si256(f, mask);
+    f = _mm256_mulhrs_epi16(f, q);
+    _mm256_store_si256(&r[i], f);
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+         MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_compress_avx2 MLKEM_NAMESPACE(empty_cu_compress_avx2)
+int empty_cu_compress_avx2;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+          MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#include "consts_avx512.h"
+
+ALIGN const int16_t qdata_avx512[_AVX512_ZETAS_LEN] = {
+#include "x86_64_avx512_zetas.i"
+};
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_consts_avx512 MLKEM_NAMESPACE(empty_cu_consts_avx512)
+int empty_cu_consts_avx512;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
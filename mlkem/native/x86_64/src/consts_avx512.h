@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CONSTS_AVX512_H
+#define CONSTS_AVX512_H
+
+#include <stdint.h>
+#include "common.h"
+
+/*
+ * Layout of the AVX-512 twiddle table, in int16 offsets.
+ * See gen_avx512_ntt_zetas() in scripts/autogenerate_files.py.
+ *
+ * Except for the scalars used by layers 1-3, every entry is a vector of
+ * 32 twisted constants (c * q^-1 mod 2^16) followed by a vector of the
+ * 32 constants c themselves.
+ */
+#define _AVX512_ZETAS_L123 0        /* zetas[1..7]; twisted at +16 */
+#define _AVX512_ZETAS_L4567 32      /* 4 blocks of 256, see ntt_avx512.c */
+#define _AVX512_ZETAS_INV_L7654 1056 /* 4 blocks of 256 */
+#define _AVX512_ZETAS_MULCACHE 2080 /* 8 blocks of 64 */
+#define _AVX512_ZETAS_LEN 2592
+
+#define qdata_avx512 MLKEM_NAMESPACE(qdata_avx512)
+extern const int16_t qdata_avx512[_AVX512_ZETAS_LEN];
+
+#endif
@@ -24,9 +24,21 @@
 #define MLKEM_USE_NATIVE_POLY_REDUCE
 #define MLKEM_USE_NATIVE_POLY_TOMONT
 #define MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY_CACHED
+#define MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY
 #define MLKEM_USE_NATIVE_POLY_MULCACHE_COMPUTE
 #define MLKEM_USE_NATIVE_POLY_TOBYTES
 #define MLKEM_USE_NATIVE_POLY_FROMBYTES
+#define MLKEM_USE_NATIVE_POLY_MODULUS_CHECK
+#define MLKEM_USE_NATIVE_POLY_COMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_COMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU
+#define MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV
+#define MLKEM_USE_NATIVE_POLY_FROMMSG
+#define MLKEM_USE_NATIVE_POLY_TOMSG
+#define MLKEM_USE_NATIVE_POLY_CBD_ETA1
+#define MLKEM_USE_NATIVE_POLY_CBD_ETA2
 
 #define INVNTT_BOUND_NATIVE (8 * MLKEM_Q)
 #define NTT_BOUND_NATIVE (8 * MLKEM_Q)
@@ -39,13 +51,7 @@ static INLINE void poly_permute_bitrev_to_custom(poly *data)
 static INLINE int rej_uniform_native(int16_t *r, unsigned int len,
                                      const uint8_t *buf, unsigned int buflen)
 {
-  /* AVX2 implementation assumes specific buffer lengths */
-  if (len != MLKEM_N || buflen != REJ_UNIFORM_AVX_BUFLEN)
-  {
-    return -1;
-  }
-
-  return (int)rej_uniform_avx2(r, buf);
+  return (int)rej_uniform_avx2(r, len, buf, buflen);
 }
 
 static INLINE void ntt_native(poly *data)
@@ -79,7 +85,16 @@ static INLINE void polyvec_basemul_acc_montgomery_cached_native(
     poly *r, const polyvec *a, const polyvec *b,
     const polyvec_mulcache *b_cache)
 {
-  polyvec_basemul_acc_montgomery_cached_avx2(r, a, b, b_cache);
+  /* TODO: Use mulcache for AVX2. So far, it is unused. */
+  ((void)b_cache);
+  polyvec_basemul_acc_montgomery_avx2(r, a, b);
+}
+
+static INLINE void polyvec_basemul_acc_montgomery_native(poly *r,
+                                                         const polyvec *a,
+                                                         const polyvec *b)
+{
+  polyvec_basemul_acc_montgomery_avx2(r, a, b);
 }
 
 static INLINE void poly_tobytes_native(uint8_t r[MLKEM_POLYBYTES],
@@ -94,4 +109,106 @@ static INLINE void poly_frombytes_native(poly *r,
   nttfrombytes_avx2((__m256i *)r->coeffs, a, qdata.vec);
 }
 
+static INLINE int poly_modulus_check_native(const uint8_t a[MLKEM_POLYBYTES])
+{
+  return modulus_check_avx2(a);
+}
+
+static INLINE void poly_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a)
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_compress_d11_avx2(r, (const __m256i *)a->coeffs);
+#else
+  poly_compress_d10_avx2(r, (const __m256i *)a->coeffs);
+#endif
+}
+
+static INLINE void poly_decompress_du_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_decompress_d11_avx2((__m256i *)r->coeffs, a);
+#else
+  poly_decompress_d10_avx2((__m256i *)r->coeffs, a);
+#endif
+}
+
+static INLINE void poly_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a)
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_compress_d5_avx2(r, (const __m256i *)a->coeffs);
+#else
+  poly_compress_d4_avx2(r, (const __m256i *)a->coeffs);
+#endif
+}
+
+static INLINE void poly_decompress_dv_native(
+    poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV])
+{
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_decompress_d5_avx2((__m256i *)r->coeffs, a);
+#else
+  poly_decompress_d4_avx2((__m256i *)r->coeffs, a);
+#endif
+}
+
+static INLINE void poly_invntt_add_compress_du_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], poly *b, const poly *e)
+{
+  invntt_avx2((__m256i *)b->coeffs, qdata.vec);
+#if (MLKEM_POLYCOMPRESSEDBYTES_DU == 352)
+  poly_add_reduce_compress_d11_avx2(r, (const __m256i *)b->coeffs,
+                                    (const __m256i *)e->coeffs);
+#else
+  poly_add_reduce_compress_d10_avx2(r, (const __m256i *)b->coeffs,
+                                    (const __m256i *)e->coeffs);
+#endif
+}
+
+static INLINE void poly_invntt_add_compress_dv_native(
+    uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], poly *a, const poly *e,
+    const poly *m)
+{
+  invntt_avx2((__m256i *)a->coeffs, qdata.vec);
+#if (MLKEM_POLYCOMPRESSEDBYTES_DV == 160)
+  poly_add_reduce_compress_d5_avx2(r, (const __m256i *)a->coeffs,
+                                   (const __m256i *)e->coeffs,
+                                   (const __m256i *)m->coeffs);
+#else
+  poly_add_reduce_compress_d4_avx2(r, (const __m256i *)a->coeffs,
+                                   (const __m256i *)e->coeffs,
+                                   (const __m256i *)m->coeffs);
+#endif
+}
+
+static INLINE void poly_frommsg_native(
+    poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES])
+{
+  poly_frommsg_avx2((__m256i *)r->coeffs, msg);
+}
+
+static INLINE void poly_tomsg_native(uint8_t msg[MLKEM_INDCPA_MSGBYTES],
+                                     const poly *a)
+{
+  poly_tomsg_avx2(msg, (const __m256i *)a->coeffs);
+}
+
+static INLINE void poly_cbd_eta1_native(
+    poly *r, const uint8_t buf[MLKEM_ETA1 * MLKEM_N / 4])
+{
+#if MLKEM_ETA1 == 3
+  poly_cbd3_avx2((__m256i *)r->coeffs, buf);
+#else
+  poly_cbd2_avx2((__m256i *)r->coeffs, buf);
+#endif
+}
+
+static INLINE void poly_cbd_eta2_native(
+    poly *r, const uint8_t buf[MLKEM_ETA2 * MLKEM_N / 4])
+{
+  poly_cbd2_avx2((__m256i *)r->coeffs, buf);
+}
+
 #endif /* MLKEM_NATIVE_ARITH_PROFILE_IMPL_H */
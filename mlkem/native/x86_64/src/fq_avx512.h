@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef FQ_AVX512_H
+#define FQ_AVX512_H
+
+#include <immintrin.h>
+#include "common.h"
+
+/*
+ * Modular arithmetic on vectors of 32 int16 values.
+ *
+ * The results are bit-identical to fqmul() and barrett_reduce()
+ * from the C reference implementation.
+ */
+
+#define AVX512_QINV -3327 /* q^-1 mod 2^16 */
+#define AVX512_V 20159    /* floor(2^26/q + 0.5) */
+
+/*
+ * Montgomery multiplication a * b * 2^-16 mod q, with output bound
+ * by q in absolute value if b is. btw = b * q^-1 mod 2^16 must be
+ * precomputed.
+ */
+static INLINE __m512i fqmul_avx512(__m512i a, __m512i b, __m512i btw)
+{
+  __m512i hi = _mm512_mulhi_epi16(a, b);
+  __m512i t = _mm512_mullo_epi16(a, btw);
+  t = _mm512_mulhi_epi16(t, _mm512_set1_epi16(MLKEM_Q));
+  return _mm512_sub_epi16(hi, t);
+}
+
+/* Barrett reduction to the centered range (-q/2, q/2] */
+static INLINE __m512i barrett_reduce_avx512(__m512i a)
+{
+  __m512i t = _mm512_mulhi_epi16(a, _mm512_set1_epi16(AVX512_V));
+  t = _mm512_add_epi16(t, _mm512_set1_epi16(1 << 9));
+  t = _mm512_srai_epi16(t, 10);
+  t = _mm512_mullo_epi16(t, _mm512_set1_epi16(MLKEM_Q));
+  return _mm512_sub_epi16(a, t);
+}
+
+#endif
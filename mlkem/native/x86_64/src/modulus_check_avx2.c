@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+int modulus_check_avx2(const uint8_t *a)
+{
+  unsigned int i;
+  const __m256i bound = _mm256_set1_epi16(MLKEM_Q - 1);
+  const __m256i mask = _mm256_set1_epi16(0xFFF);
+  /*
+   * Bytes [b0, b1, b1, b2] for each triple of input bytes. The upper
+   * lane is loaded 8 bytes after the lower one, so its 12 bytes of
+   * interest start at offset 4.
+   */
+  const __m256i idx8 =
+      _mm256_set_epi8(15, 14, 14, 13, 12, 11, 11, 10, 9, 8, 8, 7, 6, 5, 5, 4,
+                      11, 10, 10, 9, 8, 7, 7, 6, 5, 4, 4, 3, 2, 1, 1, 0);
+  __m256i f, bad = _mm256_setzero_si256();
+
+  /* 16 coefficients from 24 bytes per iteration; loads stay in bounds */
+  for (i = 0; i < MLKEM_POLYBYTES; i += 24)
+  {
+    f = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)&a[i]));
+    f = _mm256_inserti128_si256(
+        f, _mm_loadu_si128((const __m128i *)&a[i + 8]), 1);
+    f = _mm256_shuffle_epi8(f, idx8);
+    f = _mm256_blend_epi16(f, _mm256_srli_epi16(f, 4), 0xAA);
+    f = _mm256_and_si256(f, mask);
+    bad = _mm256_or_si256(bad, _mm256_cmpgt_epi16(f, bound));
+  }
+
+  return !_mm256_testz_si256(bad, bad);
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_modulus_check_avx2 MLKEM_NAMESPACE(empty_cu_modulus_check_avx2)
+int empty_cu_modulus_check_avx2;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT */
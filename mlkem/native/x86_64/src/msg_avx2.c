@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT) || \
+    defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+void poly_frommsg_avx2(__m256i *r, const uint8_t msg[32])
+{
+  unsigned int i;
+  const __m256i hqs = _mm256_set1_epi16((MLKEM_Q + 1) / 2);
+  const __m256i bits = _mm256_set_epi16(
+      (int16_t)0x8000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0100,
+      0x0080, 0x0040, 0x0020, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001);
+  __m256i f;
+
+  /*
+   * 16 coefficients from 2 message bytes per iteration. Each lane isolates
+   * its bit and turns it into an all-ones/all-zeros mask by comparison,
+   * so no branch or memory access depends on the message.
+   */
+  for (i = 0; i < MLKEM_N / 16; i++)
+  {
+    f = _mm256_set1_epi16((int16_t)(msg[2 * i] | (msg[2 * i + 1] << 8)));
+    f = _mm256_and_si256(f, bits);
+    f = _mm256_cmpeq_epi16(f, bits);
+    f = _mm256_and_si256(f, hqs);
+    _mm256_store_si256(&r[i], f);
+  }
+}
+
+void poly_tomsg_avx2(uint8_t msg[32], const __m256i *a)
+{
+  unsigned int i;
+  uint32_t small;
+  __m256i f0, f1, g0, g1;
+  const __m256i hq = _mm256_set1_epi16((MLKEM_Q - 1) / 2);
+  const __m256i hhq = _mm256_set1_epi16((MLKEM_Q - 1) / 4);
+
+  /*
+   * A coefficient compresses to 1 iff it is closer to Q/2 than to 0 or Q.
+   * Compute |(Q-1)/2 - x| (off by one for negative values, which matches
+   * the rounding of scalar_compress_d1), subtract (Q-1)/4, and collect the
+   * sign bits of 32 coefficients at a time with movemask.
+   */
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    f0 = _mm256_load_si256(&a[2 * i + 0]);
+    f1 = _mm256_load_si256(&a[2 * i + 1]);
+    f0 = _mm256_sub_epi16(hq, f0);
+    f1 = _mm256_sub_epi16(hq, f1);
+    g0 = _mm256_srai_epi16(f0, 15);
+    g1 = _mm256_srai_epi16(f1, 15);
+    f0 = _mm256_xor_si256(f0, g0);
+    f1 = _mm256_xor_si256(f1, g1);
+    f0 = _mm256_sub_epi16(f0, hhq);
+    f1 = _mm256_sub_epi16(f1, hhq);
+    f0 = _mm256_packs_epi16(f0, f1);
+    f0 = _mm256_permute4x64_epi64(f0, 0xD8);
+    small = (uint32_t)_mm256_movemask_epi8(f0);
+    msg[4 * i + 0] = (uint8_t)small;
+    msg[4 * i + 1] = (uint8_t)(small >> 8);
+    msg[4 * i + 2] = (uint8_t)(small >> 16);
+    msg[4 * i + 3] = (uint8_t)(small >> 24);
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+         MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_msg_avx2 MLKEM_NAMESPACE(empty_cu_msg_avx2)
+int empty_cu_msg_avx2;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+          MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#if !defined(__AVX512F__) || !defined(__AVX512BW__) || \
+    !defined(__AVX512VBMI__) || !defined(__AVX512VBMI2__)
+#error This file must be compiled with AVX512F, AVX512BW, AVX512VBMI and AVX512VBMI2
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64_avx512.h"
+#include "consts_avx512.h"
+#include "fq_avx512.h"
+
+/*
+ * The polynomial is held in 8 vectors of 32 coefficients each.
+ *
+ * Layers 1-3 (len 128, 64, 32) combine entire vectors and use broadcast
+ * twiddles. Layers 4-7 (len 16, 8, 4, 2) combine two vectors V[2m], V[2m+1]
+ * holding 64 consecutive coefficients: before each of those layers, the
+ * pair is transposed at the granularity of the butterfly length, so that
+ * the butterfly again combines the two vectors element-wise. All transposes
+ * are involutions, and they are undone in reverse order at the end.
+ *
+ * The order of coefficients is the same as for the C reference NTT.
+ * The forward NTT computes the same results as the C reference; the
+ * inverse NTT reduces lazily, see invntt_avx512().
+ */
+
+static INLINE __m512i load_avx512(const int16_t *p)
+{
+  return _mm512_loadu_si512((const void *)p);
+}
+
+/* Load the broadcast of scalar twiddle i, and its twisted version */
+#define LOAD_SCALAR(z, ztw, qdata, i)                        \
+  do                                                         \
+  {                                                          \
+    (z) = _mm512_set1_epi16((qdata)[_AVX512_ZETAS_L123 + (i)]); \
+    (ztw) = _mm512_set1_epi16((qdata)[_AVX512_ZETAS_L123 + 16 + (i)]); \
+  } while (0)
+
+static INLINE void ct_butterfly(__m512i *a, __m512i *b, __m512i z,
+                                __m512i ztw)
+{
+  __m512i t = fqmul_avx512(*b, z, ztw);
+  *b = _mm512_sub_epi16(*a, t);
+  *a = _mm512_add_epi16(*a, t);
+}
+
+/* Gentleman-Sande butterfly without reduction of the sum */
+static INLINE void gs_butterfly(__m512i *a, __m512i *b, __m512i z,
+                                __m512i ztw)
+{
+  __m512i t = *a;
+  *a = _mm512_add_epi16(t, *b);
+  *b = fqmul_avx512(_mm512_sub_epi16(*b, t), z, ztw);
+}
+
+/* Gentleman-Sande butterfly with Barrett reduction of the sum */
+static INLINE void gs_butterfly_reduce(__m512i *a, __m512i *b, __m512i z,
+                                       __m512i ztw)
+{
+  gs_butterfly(a, b, z, ztw);
+  *a = barrett_reduce_avx512(*a);
+}
+
+/* Butterflies on a pair of vectors, with twiddle vector at zv */
+static INLINE void ct_butterfly_vec(__m512i *a, __m512i *b, const int16_t *zv)
+{
+  ct_butterfly(a, b, load_avx512(zv + 32), load_avx512(zv));
+}
+
+static INLINE void gs_butterfly_vec(__m512i *a, __m512i *b, const int16_t *zv)
+{
+  gs_butterfly(a, b, load_avx512(zv + 32), load_avx512(zv));
+}
+
+static INLINE void gs_butterfly_reduce_vec(__m512i *a, __m512i *b,
+                                           const int16_t *zv)
+{
+  gs_butterfly_reduce(a, b, load_avx512(zv + 32), load_avx512(zv));
+}
+
+/* Swap the upper 256 bits of *x with the lower 256 bits of *y */
+static INLINE void transpose256(__m512i *x, __m512i *y)
+{
+  __m512i a = *x, b = *y;
+  *x = _mm512_shuffle_i64x2(a, b, 0x44);
+  *y = _mm512_shuffle_i64x2(a, b, 0xEE);
+}
+
+/* Transpose 2x2 blocks of 128-bit lanes within each 256-bit half */
+static INLINE void transpose128(__m512i *x, __m512i *y)
+{
+  __m512i a = *x, b = *y;
+  *x = _mm512_permutex2var_epi64(a, _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0),
+                                 b);
+  *y = _mm512_permutex2var_epi64(
+      a, _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2), b);
+}
+
+/* Transpose 2x2 blocks of 64-bit lanes within each 128-bit lane */
+static INLINE void transpose64(__m512i *x, __m512i *y)
+{
+  __m512i a = *x, b = *y;
+  *x = _mm512_unpacklo_epi64(a, b);
+  *y = _mm512_unpackhi_epi64(a, b);
+}
+
+/* Transpose 2x2 blocks of 32-bit lanes within each 64-bit lane */
+static INLINE void transpose32(__m512i *x, __m512i *y)
+{
+  __m512i a = *x, b = *y;
+  *x = _mm512_mask_blend_epi32(0xAAAA, a, _mm512_slli_epi64(b, 32));
+  *y = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(a, 32), b);
+}
+
+void ntt_avx512(int16_t *r, const int16_t *qdata)
+{
+  const int16_t *zm = qdata + _AVX512_ZETAS_L4567;
+  __m512i v[8], z, ztw;
+  unsigned int i, m;
+
+  for (i = 0; i < 8; i++)
+  {
+    v[i] = load_avx512(r + 32 * i);
+  }
+
+  /* Layer 1 */
+  LOAD_SCALAR(z, ztw, qdata, 0);
+  for (i = 0; i < 4; i++)
+  {
+    ct_butterfly(&v[i], &v[i + 4], z, ztw);
+  }
+
+  /* Layer 2 */
+  for (m = 0; m < 2; m++)
+  {
+    LOAD_SCALAR(z, ztw, qdata, 1 + m);
+    ct_butterfly(&v[4 * m + 0], &v[4 * m + 2], z, ztw);
+    ct_butterfly(&v[4 * m + 1], &v[4 * m + 3], z, ztw);
+  }
+
+  /* Layer 3 */
+  for (m = 0; m < 4; m++)
+  {
+    LOAD_SCALAR(z, ztw, qdata, 3 + m);
+    ct_butterfly(&v[2 * m], &v[2 * m + 1], z, ztw);
+  }
+
+  /* Layers 4-7, on all pairs of vectors at once for better ILP */
+  for (m = 0; m < 4; m++)
+  {
+    transpose256(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 0);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    transpose128(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 64);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 128);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    ct_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 192);
+  }
+
+  for (m = 0; m < 4; m++)
+  {
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+    transpose128(&v[2 * m], &v[2 * m + 1]);
+    transpose256(&v[2 * m], &v[2 * m + 1]);
+  }
+
+  for (i = 0; i < 8; i++)
+  {
+    _mm512_storeu_si512((void *)(r + 32 * i), v[i]);
+  }
+}
+
+void invntt_avx512(int16_t *r, const int16_t *qdata)
+{
+  /* f = mont^2/128 = 1441, and its twisted version */
+  const __m512i f = _mm512_set1_epi16(1441);
+  const __m512i ftw = _mm512_set1_epi16(-10079);
+  const int16_t *zm = qdata + _AVX512_ZETAS_INV_L7654;
+  __m512i v[8], z, ztw;
+  unsigned int i, m;
+
+  /*
+   * Differences of the Gentleman-Sande butterflies are reduced by the
+   * Montgomery multiplication and are bound by q. Sums double in size
+   * every layer, so they are only reduced in layers 5 and 1:
+   *
+   * After scaling by f, all coefficients are bound by q. Sums are bound
+   * by 2q, 4q and 8q after layers 7, 6 and 5, then by q/2 after Barrett
+   * reduction, and by q, 2q and 4q after layers 4, 3 and 2. Finally,
+   * sums are Barrett-reduced in layer 1, so the output is bound by q.
+   */
+
+  /* Scale by f as in the C reference */
+  for (i = 0; i < 8; i++)
+  {
+    v[i] = fqmul_avx512(load_avx512(r + 32 * i), f, ftw);
+  }
+
+  /* Layers 7-4, on all pairs of vectors at once for better ILP */
+  for (m = 0; m < 4; m++)
+  {
+    transpose256(&v[2 * m], &v[2 * m + 1]);
+    transpose128(&v[2 * m], &v[2 * m + 1]);
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+  }
+
+  for (m = 0; m < 4; m++)
+  {
+    gs_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 0);
+    transpose32(&v[2 * m], &v[2 * m + 1]);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    gs_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 64);
+    transpose64(&v[2 * m], &v[2 * m + 1]);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    gs_butterfly_reduce_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 128);
+    transpose128(&v[2 * m], &v[2 * m + 1]);
+  }
+  for (m = 0; m < 4; m++)
+  {
+    gs_butterfly_vec(&v[2 * m], &v[2 * m + 1], zm + 256 * m + 192);
+    transpose256(&v[2 * m], &v[2 * m + 1]);
+  }
+
+  /* Layer 3 */
+  for (m = 0; m < 4; m++)
+  {
+    LOAD_SCALAR(z, ztw, qdata, 6 - m);
+    gs_butterfly(&v[2 * m], &v[2 * m + 1], z, ztw);
+  }
+
+  /* Layer 2 */
+  for (m = 0; m < 2; m++)
+  {
+    LOAD_SCALAR(z, ztw, qdata, 2 - m);
+    gs_butterfly(&v[4 * m + 0], &v[4 * m + 2], z, ztw);
+    gs_butterfly(&v[4 * m + 1], &v[4 * m + 3], z, ztw);
+  }
+
+  /* Layer 1 */
+  LOAD_SCALAR(z, ztw, qdata, 0);
+  for (i = 0; i < 4; i++)
+  {
+    gs_butterfly_reduce(&v[i], &v[i + 4], z, ztw);
+  }
+
+  for (i = 0; i < 8; i++)
+  {
+    _mm512_storeu_si512((void *)(r + 32 * i), v[i]);
+  }
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_ntt_avx512 MLKEM_NAMESPACE(empty_cu_ntt_avx512)
+int empty_cu_ntt_avx512;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PACK_AVX512_H
+#define PACK_AVX512_H
+
+#include <immintrin.h>
+#include "common.h"
+
+/* Mask for the 48 bytes holding 32 packed 12-bit values */
+#define AVX512_MASK_48B 0x0000FFFFFFFFFFFFULL
+
+/* Unpack 32 12-bit values from the first 48 bytes of x */
+static INLINE __m512i unpack12_avx512(__m512i x)
+{
+  /* Bytes [b0, b1, b1, b2] for each triple of input bytes */
+  const __m512i idx = _mm512_set_epi8(
+      47, 46, 46, 45, 44, 43, 43, 42, 41, 40, 40, 39, 38, 37, 37, 36, 35, 34,
+      34, 33, 32, 31, 31, 30, 29, 28, 28, 27, 26, 25, 25, 24, 23, 22, 22, 21,
+      20, 19, 19, 18, 17, 16, 16, 15, 14, 13, 13, 12, 11, 10, 10, 9, 8, 7, 7,
+      6, 5, 4, 4, 3, 2, 1, 1, 0);
+  x = _mm512_permutexvar_epi8(idx, x);
+  x = _mm512_mask_srli_epi16(x, 0xAAAAAAAA, x, 4);
+  return _mm512_and_si512(x, _mm512_set1_epi16(0xFFF));
+}
+
+#endif
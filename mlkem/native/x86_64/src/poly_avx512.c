@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#if !defined(__AVX512F__) || !defined(__AVX512BW__) || \
+    !defined(__AVX512VBMI__) || !defined(__AVX512VBMI2__)
+#error This file must be compiled with AVX512F, AVX512BW, AVX512VBMI and AVX512VBMI2
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64_avx512.h"
+#include "consts_avx512.h"
+#include "fq_avx512.h"
+#include "pack_avx512.h"
+#include "poly.h"
+#include "polyvec.h"
+
+void reduce_avx512(int16_t *r)
+{
+  unsigned int i;
+  const __m512i q = _mm512_set1_epi16(MLKEM_Q);
+
+  for (i = 0; i < MLKEM_N; i += 32)
+  {
+    __m512i x = _mm512_loadu_si512((const void *)(r + i));
+    x = barrett_reduce_avx512(x);
+    /* Add q to negative coefficients */
+    x = _mm512_add_epi16(x, _mm512_and_si512(_mm512_srai_epi16(x, 15), q));
+    _mm512_storeu_si512((void *)(r + i), x);
+  }
+}
+
+void tomont_avx512(int16_t *r)
+{
+  unsigned int i;
+  /* 2^32 mod q, and its twisted version */
+  const __m512i f = _mm512_set1_epi16(1353);
+  const __m512i ftw = _mm512_set1_epi16(20553);
+
+  for (i = 0; i < MLKEM_N; i += 32)
+  {
+    __m512i x = _mm512_loadu_si512((const void *)(r + i));
+    _mm512_storeu_si512((void *)(r + i), fqmul_avx512(x, f, ftw));
+  }
+}
+
+void poly_mulcache_compute_avx512(int16_t *x, const int16_t *a,
+                                  const int16_t *qdata)
+{
+  unsigned int i;
+  const int16_t *zv = qdata + _AVX512_ZETAS_MULCACHE;
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    /* The twiddles are [0, z, 0, -z] for each group of 4 coefficients,
+     * so the odd coefficients of t hold the mulcache entries. */
+    __m512i t = _mm512_loadu_si512((const void *)(a + 32 * i));
+    t = fqmul_avx512(t, _mm512_loadu_si512((const void *)(zv + 64 * i + 32)),
+                     _mm512_loadu_si512((const void *)(zv + 64 * i)));
+    t = _mm512_srli_epi32(t, 16);
+    _mm256_storeu_si256((__m256i *)(x + 16 * i), _mm512_cvtepi32_epi16(t));
+  }
+}
+
+/*
+ * Montgomery reduction of 32-bit accumulators acc.
+ * The result is returned in the upper 16 bits of each 32-bit lane.
+ */
+static INLINE __m512i montgomery_reduce32_avx512(__m512i acc)
+{
+  /* The lower 16 bits of each 32-bit lane of t are (int16_t)(acc * QINV) */
+  __m512i t = _mm512_mullo_epi16(acc, _mm512_set1_epi16(AVX512_QINV));
+  t = _mm512_mulhi_epi16(t, _mm512_set1_epi16(MLKEM_Q));
+  /* The lower 16 bits of acc and t * q agree, so there is no borrow */
+  return _mm512_sub_epi16(acc, _mm512_slli_epi32(t, 16));
+}
+
+void polyvec_basemul_acc_montgomery_cached_avx512(
+    poly *r, const polyvec *a, const polyvec *b,
+    const polyvec_mulcache *b_cache)
+{
+  unsigned int i, k;
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    __m512i acc0 = _mm512_setzero_si512();
+    __m512i acc1 = _mm512_setzero_si512();
+
+    /* Accumulate all products in 32 bits and reduce only once.
+     * The inputs from a are bound by 4096, so the accumulators are bound
+     * by 2 * MLKEM_K * 4096 * INT16_MAX < 2^31. */
+    for (k = 0; k < MLKEM_K; k++)
+    {
+      __m512i x = _mm512_loadu_si512((const void *)(a->vec[k].coeffs + 32 * i));
+      __m512i y = _mm512_loadu_si512((const void *)(b->vec[k].coeffs + 32 * i));
+      __m512i c = _mm512_cvtepu16_epi32(_mm256_loadu_si256(
+          (const __m256i *)(b_cache->vec[k].coeffs + 16 * i)));
+      /* [b0, b_cached] and [b1, b0] for each pair of coefficients */
+      __m512i y0 = _mm512_mask_blend_epi16(0xAAAAAAAA, y,
+                                           _mm512_slli_epi32(c, 16));
+      __m512i y1 = _mm512_rol_epi32(y, 16);
+
+      acc0 = _mm512_add_epi32(acc0, _mm512_madd_epi16(x, y0));
+      acc1 = _mm512_add_epi32(acc1, _mm512_madd_epi16(x, y1));
+    }
+
+    acc0 = _mm512_srli_epi32(montgomery_reduce32_avx512(acc0), 16);
+    acc1 = montgomery_reduce32_avx512(acc1);
+    _mm512_storeu_si512((void *)(r->coeffs + 32 * i),
+                        _mm512_mask_blend_epi16(0xAAAAAAAA, acc0, acc1));
+  }
+}
+
+void ntttobytes_avx512(uint8_t *r, const int16_t *a)
+{
+  unsigned int i;
+  /* Gather bytes 0, 1, 2 of every 32-bit lane */
+  const __m512i idx = _mm512_set_epi8(
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 61, 60, 58, 57, 56,
+      54, 53, 52, 50, 49, 48, 46, 45, 44, 42, 41, 40, 38, 37, 36, 34, 33, 32,
+      30, 29, 28, 26, 25, 24, 22, 21, 20, 18, 17, 16, 14, 13, 12, 10, 9, 8, 6,
+      5, 4, 2, 1, 0);
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    __m512i t = _mm512_loadu_si512((const void *)(a + 32 * i));
+    /* t0 + 2^12 * t1 for each pair of coefficients */
+    t = _mm512_madd_epi16(t, _mm512_set1_epi32(0x10000001));
+    t = _mm512_permutexvar_epi8(idx, t);
+    _mm512_mask_storeu_epi8(r + 48 * i, AVX512_MASK_48B, t);
+  }
+}
+
+void nttfrombytes_avx512(int16_t *r, const uint8_t *a)
+{
+  unsigned int i;
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    __m512i x = _mm512_maskz_loadu_epi8(AVX512_MASK_48B, a + 48 * i);
+    _mm512_storeu_si512((void *)(r + 32 * i), unpack12_avx512(x));
+  }
+}
+
+int modulus_check_avx512(const uint8_t *a)
+{
+  unsigned int i;
+  __mmask32 bad = 0;
+  const __m512i bound = _mm512_set1_epi16(MLKEM_Q - 1);
+
+  for (i = 0; i < MLKEM_N / 32; i++)
+  {
+    __m512i x = _mm512_maskz_loadu_epi8(AVX512_MASK_48B, a + 48 * i);
+    bad |= _mm512_cmpgt_epi16_mask(unpack12_avx512(x), bound);
+  }
+  return bad != 0;
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_poly_avx512 MLKEM_NAMESPACE(empty_cu_poly_avx512)
+int empty_cu_poly_avx512;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -21,7 +21,8 @@
 #define _mm256_cmpge_epu16(a, b) _mm256_cmpeq_epi16(_mm256_max_epu16(a, b), a)
 #define _mm_cmpge_epu16(a, b) _mm_cmpeq_epi16(_mm_max_epu16(a, b), a)
 
-unsigned int rej_uniform_avx2(int16_t *RESTRICT r, const uint8_t *buf)
+unsigned int rej_uniform_avx2(int16_t *RESTRICT r, unsigned int len,
+                              const uint8_t *buf, unsigned int buflen)
 {
   unsigned int ctr, pos;
   uint16_t val0, val1;
@@ -35,8 +36,13 @@ unsigned int rej_uniform_avx2(int16_t *RESTRICT r, const uint8_t *buf)
   __m256i f0, f1, g0, g1, g2, g3;
   __m128i f, t, pilo, pihi;
 
+  /*
+   * The vector loops store full vectors at r[ctr], so they only run as long
+   * as those stores stay within the first len entries of r. The loads are
+   * bounded by buflen likewise. The remainder is handled by the scalar loop.
+   */
   ctr = pos = 0;
-  while (ctr <= MLKEM_N - 32 && pos <= REJ_UNIFORM_AVX_BUFLEN - 48)
+  while (ctr + 32 <= len && pos + 48 <= buflen)
   {
     f0 = _mm256_loadu_si256((__m256i *)&buf[pos]);
     /* Don't load from offset 24, as this would over-read the buffer */
@@ -88,7 +94,7 @@ unsigned int rej_uniform_avx2(int16_t *RESTRICT r, const uint8_t *buf)
     ctr += _mm_popcnt_u32((good >> 24) & 0xFF);
   }
 
-  while (ctr <= MLKEM_N - 8 && pos <= REJ_UNIFORM_AVX_BUFLEN - 24)
+  while (ctr + 8 <= len && pos + 16 <= buflen)
   {
     f = _mm_loadu_si128((__m128i *)&buf[pos]);
     f = _mm_shuffle_epi8(f, _mm256_castsi256_si128(idx8));
@@ -110,7 +116,7 @@ unsigned int rej_uniform_avx2(int16_t *RESTRICT r, const uint8_t *buf)
     ctr += _mm_popcnt_u32(good);
   }
 
-  while (ctr < MLKEM_N && pos <= REJ_UNIFORM_AVX_BUFLEN - 3)
+  while (ctr < len && pos + 3 <= buflen)
   {
     val0 = ((buf[pos + 0] >> 0) | ((uint16_t)buf[pos + 1] << 8)) & 0xFFF;
     val1 = ((buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4));
@@ -118,7 +124,7 @@ unsigned int rej_uniform_avx2(int16_t *RESTRICT r, const uint8_t *buf)
 
     if (val0 < MLKEM_Q)
       r[ctr++] = val0;
-    if (val1 < MLKEM_Q && ctr < MLKEM_N)
+    if (val1 < MLKEM_Q && ctr < len)
       r[ctr++] = val1;
   }
 
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.h"
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+
+#if !defined(__AVX512F__) || !defined(__AVX512BW__) || \
+    !defined(__AVX512VBMI__) || !defined(__AVX512VBMI2__)
+#error This file must be compiled with AVX512F, AVX512BW, AVX512VBMI and AVX512VBMI2
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64_avx512.h"
+#include "pack_avx512.h"
+
+/*
+ * Rejection sampling using VPCOMPRESSW: every iteration unpacks up to
+ * 48 bytes into 32 candidates, compresses the candidates < q to the
+ * bottom of the vector and stores as many of them as are still needed.
+ *
+ * The last chunk of the buffer is loaded with a byte mask, so there is no
+ * separate scalar tail, and neither len nor buflen need to be multiples
+ * of anything. Trailing bytes not forming a full 3-byte group are ignored.
+ */
+unsigned int rej_uniform_avx512(int16_t *r, unsigned int len,
+                                const uint8_t *buf, unsigned int buflen)
+{
+  unsigned int ctr = 0, pos = 0;
+  const __m512i q = _mm512_set1_epi16(MLKEM_Q);
+
+  buflen -= buflen % 3;
+  while (ctr < len && pos < buflen)
+  {
+    unsigned int nbytes = buflen - pos, ncand, ngood;
+    __mmask64 load_mask = AVX512_MASK_48B;
+    __mmask32 good;
+    __m512i v;
+
+    if (nbytes < 48)
+    {
+      load_mask = (1ULL << nbytes) - 1;
+    }
+    else
+    {
+      nbytes = 48;
+    }
+    ncand = 2 * nbytes / 3;
+
+    v = unpack12_avx512(_mm512_maskz_loadu_epi8(load_mask, buf + pos));
+    good = _mm512_cmplt_epu16_mask(v, q);
+    if (ncand < 32)
+    {
+      good &= (1UL << ncand) - 1;
+    }
+    v = _mm512_maskz_compress_epi16(good, v);
+
+    ngood = (unsigned int)_mm_popcnt_u32((uint32_t)good);
+    if (ngood > len - ctr)
+    {
+      ngood = len - ctr;
+    }
+    _mm512_mask_storeu_epi16(r + ctr, (__mmask32)((1ULL << ngood) - 1), v);
+
+    ctr += ngood;
+    pos += nbytes;
+  }
+
+  return ctr;
+}
+
+#else /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+/* Dummy declaration for compilers disliking empty compilation units */
+#define empty_cu_rej_uniform_avx512 MLKEM_NAMESPACE(empty_cu_rej_uniform_avx512)
+int empty_cu_rej_uniform_avx512;
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WARNING: This file is auto-generated from scripts/autogenerate_files.py
+ *          Do not modify it directly.
+ */
+
+/*
+ * Table of zeta values used in the AVX-512 NTTs
+ * See autogenerate_files.py for details.
+ */
+
+-758, -359, -1517, 1493, 1422, 287, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31498,
+    14745, 787, 13525, -12402, 28191, -16694, 0, 0, 0, 0, 0, 0, 0, 0, 0, -20907,
+    -20907, -20907, -20907, -20907, -20907, -20907, -20907, -20907, -20907,
+    -20907, -20907, -20907, -20907, -20907, -20907, 27758, 27758, 27758, 27758,
+    27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758,
+    27758, -171, -171, -171, -171, -171, -171, -171, -171, -171, -171, -171,
+    -171, -171, -171, -171, -171, 622, 622, 622, 622, 622, 622, 622, 622, 622,
+    622, 622, 622, 622, 622, 622, 622, -5827, -5827, -5827, -5827, -5827, -5827,
+    -5827, -5827, 17363, 17363, 17363, 17363, 17363, 17363, 17363, 17363,
+    -26360, -26360, -26360, -26360, -26360, -26360, -26360, -26360, -29057,
+    -29057, -29057, -29057, -29057, -29057, -29057, -29057, 573, 573, 573, 573,
+    573, 573, 573, 573, -1325, -1325, -1325, -1325, -1325, -1325, -1325, -1325,
+    264, 264, 264, 264, 264, 264, 264, 264, 383, 383, 383, 383, 383, 383, 383,
+    383, -5689, -5689, -5689, -5689, -6516, -6516, -6516, -6516, 1496, 1496,
+    1496, 1496, 30967, 30967, 30967, 30967, -23565, -23565, -23565, -23565,
+    20179, 20179, 20179, 20179, 20710, 20710, 20710, 20710, 25080, 25080, 25080,
+    25080, 1223, 1223, 1223, 1223, 652, 652, 652, 652, -552, -552, -552, -552,
+    1015, 1015, 1015, 1015, -1293, -1293, -1293, -1293, 1491, 1491, 1491, 1491,
+    -282, -282, -282, -282, -1544, -1544, -1544, -1544, -335, -335, 11182,
+    11182, -11477, -11477, 13387, 13387, -32227, -32227, -14233, -14233, 20494,
+    20494, -21655, -21655, -27738, -27738, 13131, 13131, 945, 945, -4587, -4587,
+    -14883, -14883, 23092, 23092, 6182, 6182, 5493, 5493, -1103, -1103, 430,
+    430, 555, 555, 843, 843, -1251, -1251, 871, 871, 1550, 1550, 105, 105, 422,
+    422, 587, 587, 177, 177, -235, -235, -291, -291, -460, -460, 1574, 1574,
+    1653, 1653, -3799, -3799, -3799, -3799, -3799, -3799, -3799, -3799, -3799,
+    -3799, -3799, -3799, -3799, -3799, -3799, -3799, -15690, -15690, -15690,
+    -15690, -15690, -15690, -15690, -15690, -15690, -15690, -15690, -15690,
+    -15690, -15690, -15690, -15690, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+    1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 182, 182, 182, 182,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 5571, 5571,
+    5571, 5571, 5571, 5571, 5571, 5571, -1102, -1102, -1102, -1102, -1102,
+    -1102, -1102, -1102, 21438, 21438, 21438, 21438, 21438, 21438, 21438, 21438,
+    -26242, -26242, -26242, -26242, -26242, -26242, -26242, -26242, -829, -829,
+    -829, -829, -829, -829, -829, -829, 1458, 1458, 1458, 1458, 1458, 1458,
+    1458, 1458, -1602, -1602, -1602, -1602, -1602, -1602, -1602, -1602, -130,
+    -130, -130, -130, -130, -130, -130, -130, -12796, -12796, -12796, -12796,
+    26616, 26616, 26616, 26616, 16064, 16064, 16064, 16064, -12442, -12442,
+    -12442, -12442, 9134, 9134, 9134, 9134, -650, -650, -650, -650, -25986,
+    -25986, -25986, -25986, 27837, 27837, 27837, 27837, 516, 516, 516, 516, -8,
+    -8, -8, -8, -320, -320, -320, -320, -666, -666, -666, -666, -1618, -1618,
+    -1618, -1618, -1162, -1162, -1162, -1162, 126, 126, 126, 126, 1469, 1469,
+    1469, 1469, 32010, 32010, -32502, -32502, 10631, 10631, 30317, 30317, 29175,
+    29175, -18741, -18741, -28762, -28762, 12639, 12639, -18486, -18486, 20100,
+    20100, 17560, 17560, 18525, 18525, -14430, -14430, 19529, 19529, -5276,
+    -5276, -12619, -12619, -246, -246, 778, 778, 1159, 1159, -147, -147, -777,
+    -777, 1483, 1483, -602, -602, 1119, 1119, -1590, -1590, 644, 644, -872,
+    -872, 349, 349, 418, 418, 329, 329, -156, -156, -75, -75, 10690, 10690,
+    10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690,
+    10690, 10690, 10690, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358,
+    1358, 1358, 1358, 1358, 1358, 1358, 1358, 962, 962, 962, 962, 962, 962, 962,
+    962, 962, 962, 962, 962, 962, 962, 962, 962, -1202, -1202, -1202, -1202,
+    -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202,
+    -1202, -28073, -28073, -28073, -28073, -28073, -28073, -28073, -28073,
+    24313, 24313, 24313, 24313, 24313, 24313, 24313, 24313, -10532, -10532,
+    -10532, -10532, -10532, -10532, -10532, -10532, 8800, 8800, 8800, 8800,
+    8800, 8800, 8800, 8800, -681, -681, -681, -681, -681, -681, -681, -681,
+    1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 732, 732, 732, 732, 732,
+    732, 732, 732, 608, 608, 608, 608, 608, 608, 608, 608, 19883, 19883, 19883,
+    19883, -28250, -28250, -28250, -28250, -15887, -15887, -15887, -15887,
+    -8898, -8898, -8898, -8898, -28309, -28309, -28309, -28309, 9075, 9075,
+    9075, 9075, -30199, -30199, -30199, -30199, 18249, 18249, 18249, 18249,
+    -853, -853, -853, -853, -90, -90, -90, -90, -271, -271, -271, -271, 830,
+    830, 830, 830, 107, 107, 107, 107, -1421, -1421, -1421, -1421, -247, -247,
+    -247, -247, -951, -951, -951, -951, -31183, -31183, 20297, 20297, 25435,
+    25435, 2146, 2146, -7382, -7382, 15355, 15355, 24391, 24391, -32384, -32384,
+    -20927, -20927, -6280, -6280, 10946, 10946, -14903, -14903, 24214, 24214,
+    -11044, -11044, 16989, 16989, 14469, 14469, 817, 817, 1097, 1097, 603, 603,
+    610, 610, 1322, 1322, -1285, -1285, -1465, -1465, 384, 384, -1215, -1215,
+    -136, -136, 1218, 1218, -1335, -1335, -874, -874, 220, 220, -1187, -1187,
+    -1659, -1659, -11202, -11202, -11202, -11202, -11202, -11202, -11202,
+    -11202, -11202, -11202, -11202, -11202, -11202, -11202, -11202, -11202,
+    31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164,
+    31164, 31164, 31164, 31164, 31164, -1474, -1474, -1474, -1474, -1474, -1474,
+    -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474, 1468,
+    1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+    1468, 1468, 1468, 18426, 18426, 18426, 18426, 18426, 18426, 18426, 18426,
+    8859, 8859, 8859, 8859, 8859, 8859, 8859, 8859, 26675, 26675, 26675, 26675,
+    26675, 26675, 26675, 26675, -16163, -16163, -16163, -16163, -16163, -16163,
+    -16163, -16163, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, 411,
+    411, 411, 411, 411, 411, 411, 411, -205, -205, -205, -205, -205, -205, -205,
+    -205, -1571, -1571, -1571, -1571, -1571, -1571, -1571, -1571, 13426, 13426,
+    13426, 13426, 14017, 14017, 14017, 14017, -29156, -29156, -29156, -29156,
+    -12757, -12757, -12757, -12757, 16832, 16832, 16832, 16832, 4311, 4311,
+    4311, 4311, -24155, -24155, -24155, -24155, -17915, -17915, -17915, -17915,
+    -398, -398, -398, -398, 961, 961, 961, 961, -1508, -1508, -1508, -1508,
+    -725, -725, -725, -725, 448, 448, 448, 448, -1065, -1065, -1065, -1065, 677,
+    677, 677, 677, -1275, -1275, -1275, -1275, 10335, 10335, -21498, -21498,
+    -7934, -7934, -20198, -20198, -22502, -22502, 23210, 23210, 10906, 10906,
+    -17442, -17442, 31636, 31636, -23860, -23860, 28644, 28644, -20257, -20257,
+    23998, 23998, 7756, 7756, -17422, -17422, 23132, 23132, -1185, -1185, -1530,
+    -1530, -1278, -1278, 794, 794, -1510, -1510, -854, -854, -870, -870, 478,
+    478, -108, -108, -308, -308, 996, 996, 991, 991, 958, 958, -1460, -1460,
+    1522, 1522, 1628, 1628, 23132, 23132, -17422, -17422, 7756, 7756, 23998,
+    23998, -20257, -20257, 28644, 28644, -23860, -23860, 31636, 31636, -17442,
+    -17442, 10906, 10906, 23210, 23210, -22502, -22502, -20198, -20198, -7934,
+    -7934, -21498, -21498, 10335, 10335, 1628, 1628, 1522, 1522, -1460, -1460,
+    958, 958, 991, 991, 996, 996, -308, -308, -108, -108, 478, 478, -870, -870,
+    -854, -854, -1510, -1510, 794, 794, -1278, -1278, -1530, -1530, -1185,
+    -1185, -17915, -17915, -17915, -17915, -24155, -24155, -24155, -24155, 4311,
+    4311, 4311, 4311, 16832, 16832, 16832, 16832, -12757, -12757, -12757,
+    -12757, -29156, -29156, -29156, -29156, 14017, 14017, 14017, 14017, 13426,
+    13426, 13426, 13426, -1275, -1275, -1275, -1275, 677, 677, 677, 677, -1065,
+    -1065, -1065, -1065, 448, 448, 448, 448, -725, -725, -725, -725, -1508,
+    -1508, -1508, -1508, 961, 961, 961, 961, -398, -398, -398, -398, -16163,
+    -16163, -16163, -16163, -16163, -16163, -16163, -16163, 26675, 26675, 26675,
+    26675, 26675, 26675, 26675, 26675, 8859, 8859, 8859, 8859, 8859, 8859, 8859,
+    8859, 18426, 18426, 18426, 18426, 18426, 18426, 18426, 18426, -1571, -1571,
+    -1571, -1571, -1571, -1571, -1571, -1571, -205, -205, -205, -205, -205,
+    -205, -205, -205, 411, 411, 411, 411, 411, 411, 411, 411, -1542, -1542,
+    -1542, -1542, -1542, -1542, -1542, -1542, 31164, 31164, 31164, 31164, 31164,
+    31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164, 31164,
+    -11202, -11202, -11202, -11202, -11202, -11202, -11202, -11202, -11202,
+    -11202, -11202, -11202, -11202, -11202, -11202, -11202, 1468, 1468, 1468,
+    1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+    1468, -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474, -1474,
+    -1474, -1474, -1474, -1474, -1474, -1474, 14469, 14469, 16989, 16989,
+    -11044, -11044, 24214, 24214, -14903, -14903, 10946, 10946, -6280, -6280,
+    -20927, -20927, -32384, -32384, 24391, 24391, 15355, 15355, -7382, -7382,
+    2146, 2146, 25435, 25435, 20297, 20297, -31183, -31183, -1659, -1659, -1187,
+    -1187, 220, 220, -874, -874, -1335, -1335, 1218, 1218, -136, -136, -1215,
+    -1215, 384, 384, -1465, -1465, -1285, -1285, 1322, 1322, 610, 610, 603, 603,
+    1097, 1097, 817, 817, 18249, 18249, 18249, 18249, -30199, -30199, -30199,
+    -30199, 9075, 9075, 9075, 9075, -28309, -28309, -28309, -28309, -8898,
+    -8898, -8898, -8898, -15887, -15887, -15887, -15887, -28250, -28250, -28250,
+    -28250, 19883, 19883, 19883, 19883, -951, -951, -951, -951, -247, -247,
+    -247, -247, -1421, -1421, -1421, -1421, 107, 107, 107, 107, 830, 830, 830,
+    830, -271, -271, -271, -271, -90, -90, -90, -90, -853, -853, -853, -853,
+    8800, 8800, 8800, 8800, 8800, 8800, 8800, 8800, -10532, -10532, -10532,
+    -10532, -10532, -10532, -10532, -10532, 24313, 24313, 24313, 24313, 24313,
+    24313, 24313, 24313, -28073, -28073, -28073, -28073, -28073, -28073, -28073,
+    -28073, 608, 608, 608, 608, 608, 608, 608, 608, 732, 732, 732, 732, 732,
+    732, 732, 732, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017, -681, -681,
+    -681, -681, -681, -681, -681, -681, 1358, 1358, 1358, 1358, 1358, 1358,
+    1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 10690, 10690,
+    10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690, 10690,
+    10690, 10690, 10690, -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202,
+    -1202, -1202, -1202, -1202, -1202, -1202, -1202, -1202, 962, 962, 962, 962,
+    962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, -12619, -12619,
+    -5276, -5276, 19529, 19529, -14430, -14430, 18525, 18525, 17560, 17560,
+    20100, 20100, -18486, -18486, 12639, 12639, -28762, -28762, -18741, -18741,
+    29175, 29175, 30317, 30317, 10631, 10631, -32502, -32502, 32010, 32010, -75,
+    -75, -156, -156, 329, 329, 418, 418, 349, 349, -872, -872, 644, 644, -1590,
+    -1590, 1119, 1119, -602, -602, 1483, 1483, -777, -777, -147, -147, 1159,
+    1159, 778, 778, -246, -246, 27837, 27837, 27837, 27837, -25986, -25986,
+    -25986, -25986, -650, -650, -650, -650, 9134, 9134, 9134, 9134, -12442,
+    -12442, -12442, -12442, 16064, 16064, 16064, 16064, 26616, 26616, 26616,
+    26616, -12796, -12796, -12796, -12796, 1469, 1469, 1469, 1469, 126, 126,
+    126, 126, -1162, -1162, -1162, -1162, -1618, -1618, -1618, -1618, -666,
+    -666, -666, -666, -320, -320, -320, -320, -8, -8, -8, -8, 516, 516, 516,
+    516, -26242, -26242, -26242, -26242, -26242, -26242, -26242, -26242, 21438,
+    21438, 21438, 21438, 21438, 21438, 21438, 21438, -1102, -1102, -1102, -1102,
+    -1102, -1102, -1102, -1102, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571,
+    -130, -130, -130, -130, -130, -130, -130, -130, -1602, -1602, -1602, -1602,
+    -1602, -1602, -1602, -1602, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458,
+    -829, -829, -829, -829, -829, -829, -829, -829, -15690, -15690, -15690,
+    -15690, -15690, -15690, -15690, -15690, -15690, -15690, -15690, -15690,
+    -15690, -15690, -15690, -15690, -3799, -3799, -3799, -3799, -3799, -3799,
+    -3799, -3799, -3799, -3799, -3799, -3799, -3799, -3799, -3799, -3799, 182,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+    1577, 1577, 1577, 1577, 5493, 5493, 6182, 6182, 23092, 23092, -14883,
+    -14883, -4587, -4587, 945, 945, 13131, 13131, -27738, -27738, -21655,
+    -21655, 20494, 20494, -14233, -14233, -32227, -32227, 13387, 13387, -11477,
+    -11477, 11182, 11182, -335, -335, 1653, 1653, 1574, 1574, -460, -460, -291,
+    -291, -235, -235, 177, 177, 587, 587, 422, 422, 105, 105, 1550, 1550, 871,
+    871, -1251, -1251, 843, 843, 555, 555, 430, 430, -1103, -1103, 25080, 25080,
+    25080, 25080, 20710, 20710, 20710, 20710, 20179, 20179, 20179, 20179,
+    -23565, -23565, -23565, -23565, 30967, 30967, 30967, 30967, 1496, 1496,
+    1496, 1496, -6516, -6516, -6516, -6516, -5689, -5689, -5689, -5689, -1544,
+    -1544, -1544, -1544, -282, -282, -282, -282, 1491, 1491, 1491, 1491, -1293,
+    -1293, -1293, -1293, 1015, 1015, 1015, 1015, -552, -552, -552, -552, 652,
+    652, 652, 652, 1223, 1223, 1223, 1223, -29057, -29057, -29057, -29057,
+    -29057, -29057, -29057, -29057, -26360, -26360, -26360, -26360, -26360,
+    -26360, -26360, -26360, 17363, 17363, 17363, 17363, 17363, 17363, 17363,
+    17363, -5827, -5827, -5827, -5827, -5827, -5827, -5827, -5827, 383, 383,
+    383, 383, 383, 383, 383, 383, 264, 264, 264, 264, 264, 264, 264, 264, -1325,
+    -1325, -1325, -1325, -1325, -1325, -1325, -1325, 573, 573, 573, 573, 573,
+    573, 573, 573, 27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758,
+    27758, 27758, 27758, 27758, 27758, 27758, 27758, 27758, -20907, -20907,
+    -20907, -20907, -20907, -20907, -20907, -20907, -20907, -20907, -20907,
+    -20907, -20907, -20907, -20907, -20907, 622, 622, 622, 622, 622, 622, 622,
+    622, 622, 622, 622, 622, 622, 622, 622, 622, -171, -171, -171, -171, -171,
+    -171, -171, -171, -171, -171, -171, -171, -171, -171, -171, -171, 0, -335,
+    0, 335, 0, 11182, 0, -11182, 0, -11477, 0, 11477, 0, 13387, 0, -13387, 0,
+    -32227, 0, 32227, 0, -14233, 0, 14233, 0, 20494, 0, -20494, 0, -21655, 0,
+    21655, 0, -1103, 0, 1103, 0, 430, 0, -430, 0, 555, 0, -555, 0, 843, 0, -843,
+    0, -1251, 0, 1251, 0, 871, 0, -871, 0, 1550, 0, -1550, 0, 105, 0, -105, 0,
+    -27738, 0, 27738, 0, 13131, 0, -13131, 0, 945, 0, -945, 0, -4587, 0, 4587,
+    0, -14883, 0, 14883, 0, 23092, 0, -23092, 0, 6182, 0, -6182, 0, 5493, 0,
+    -5493, 0, 422, 0, -422, 0, 587, 0, -587, 0, 177, 0, -177, 0, -235, 0, 235,
+    0, -291, 0, 291, 0, -460, 0, 460, 0, 1574, 0, -1574, 0, 1653, 0, -1653, 0,
+    32010, 0, -32010, 0, -32502, 0, 32502, 0, 10631, 0, -10631, 0, 30317, 0,
+    -30317, 0, 29175, 0, -29175, 0, -18741, 0, 18741, 0, -28762, 0, 28762, 0,
+    12639, 0, -12639, 0, -246, 0, 246, 0, 778, 0, -778, 0, 1159, 0, -1159, 0,
+    -147, 0, 147, 0, -777, 0, 777, 0, 1483, 0, -1483, 0, -602, 0, 602, 0, 1119,
+    0, -1119, 0, -18486, 0, 18486, 0, 20100, 0, -20100, 0, 17560, 0, -17560, 0,
+    18525, 0, -18525, 0, -14430, 0, 14430, 0, 19529, 0, -19529, 0, -5276, 0,
+    5276, 0, -12619, 0, 12619, 0, -1590, 0, 1590, 0, 644, 0, -644, 0, -872, 0,
+    872, 0, 349, 0, -349, 0, 418, 0, -418, 0, 329, 0, -329, 0, -156, 0, 156, 0,
+    -75, 0, 75, 0, -31183, 0, 31183, 0, 20297, 0, -20297, 0, 25435, 0, -25435,
+    0, 2146, 0, -2146, 0, -7382, 0, 7382, 0, 15355, 0, -15355, 0, 24391, 0,
+    -24391, 0, -32384, 0, 32384, 0, 817, 0, -817, 0, 1097, 0, -1097, 0, 603, 0,
+    -603, 0, 610, 0, -610, 0, 1322, 0, -1322, 0, -1285, 0, 1285, 0, -1465, 0,
+    1465, 0, 384, 0, -384, 0, -20927, 0, 20927, 0, -6280, 0, 6280, 0, 10946, 0,
+    -10946, 0, -14903, 0, 14903, 0, 24214, 0, -24214, 0, -11044, 0, 11044, 0,
+    16989, 0, -16989, 0, 14469, 0, -14469, 0, -1215, 0, 1215, 0, -136, 0, 136,
+    0, 1218, 0, -1218, 0, -1335, 0, 1335, 0, -874, 0, 874, 0, 220, 0, -220, 0,
+    -1187, 0, 1187, 0, -1659, 0, 1659, 0, 10335, 0, -10335, 0, -21498, 0, 21498,
+    0, -7934, 0, 7934, 0, -20198, 0, 20198, 0, -22502, 0, 22502, 0, 23210, 0,
+    -23210, 0, 10906, 0, -10906, 0, -17442, 0, 17442, 0, -1185, 0, 1185, 0,
+    -1530, 0, 1530, 0, -1278, 0, 1278, 0, 794, 0, -794, 0, -1510, 0, 1510, 0,
+    -854, 0, 854, 0, -870, 0, 870, 0, 478, 0, -478, 0, 31636, 0, -31636, 0,
+    -23860, 0, 23860, 0, 28644, 0, -28644, 0, -20257, 0, 20257, 0, 23998, 0,
+    -23998, 0, 7756, 0, -7756, 0, -17422, 0, 17422, 0, 23132, 0, -23132, 0,
+    -108, 0, 108, 0, -308, 0, 308, 0, 996, 0, -996, 0, 991, 0, -991, 0, 958, 0,
+    -958, 0, -1460, 0, 1460, 0, 1522, 0, -1522, 0, 1628, 0, -1628,
@@ -16,6 +16,7 @@
 #include "symmetric.h"
 #include "verify.h"
 
+#if !defined(MLKEM_USE_NATIVE_POLY_COMPRESS_DU)
 void poly_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a)
 {
   int j;
@@ -78,8 +79,15 @@ void poly_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a)
 #error "MLKEM_POLYCOMPRESSEDBYTES_DU needs to be in {320,352}"
 #endif
 }
+#else  /* MLKEM_USE_NATIVE_POLY_COMPRESS_DU */
+void poly_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU], const poly *a)
+{
+  POLY_UBOUND(a, MLKEM_Q);
+  poly_compress_du_native(r, a);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_COMPRESS_DU */
 
-
+#if !defined(MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU)
 void poly_decompress_du(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
 {
   int j;
@@ -138,7 +146,22 @@ void poly_decompress_du(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
 #error "MLKEM_POLYCOMPRESSEDBYTES_DU needs to be in {320,352}"
 #endif
 }
+#else  /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU */
+void poly_decompress_du(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
+{
+  poly_decompress_du_native(r, a);
+  POLY_UBOUND(r, MLKEM_Q);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DU */
+
+void poly_decompress_du_ntt(poly *r,
+                            const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
+{
+  poly_decompress_du(r, a);
+  poly_ntt(r);
+}
 
+#if !defined(MLKEM_USE_NATIVE_POLY_COMPRESS_DV)
 void poly_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a)
 {
   int i;
@@ -192,7 +215,15 @@ void poly_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a)
 #error "MLKEM_POLYCOMPRESSEDBYTES_DV needs to be in {128, 160}"
 #endif
 }
+#else  /* MLKEM_USE_NATIVE_POLY_COMPRESS_DV */
+void poly_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV], const poly *a)
+{
+  POLY_UBOUND(a, MLKEM_Q);
+  poly_compress_dv_native(r, a);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_COMPRESS_DV */
 
+#if !defined(MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV)
 void poly_decompress_dv(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV])
 {
   int i;
@@ -248,6 +279,57 @@ void poly_decompress_dv(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV])
 
   POLY_UBOUND(r, MLKEM_Q);
 }
+#else  /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV */
+void poly_decompress_dv(poly *r, const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DV])
+{
+  poly_decompress_dv_native(r, a);
+  POLY_UBOUND(r, MLKEM_Q);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_DECOMPRESS_DV */
+
+/* Check that the additions in poly_invntt_add_compress_{du,dv} cannot
+ * overflow */
+STATIC_ASSERT(INVNTT_BOUND + MLKEM_ETA1 < INT16_MAX, invntt_add_bound_0)
+STATIC_ASSERT(INVNTT_BOUND + MLKEM_ETA2 + MLKEM_Q < INT16_MAX,
+              invntt_add_bound_1)
+
+#if !defined(MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU)
+void poly_invntt_add_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU],
+                                 poly *b, const poly *e)
+{
+  poly_invntt_tomont(b);
+  poly_add(b, e);
+  poly_reduce(b);
+  poly_compress_du(r, b);
+}
+#else  /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU */
+void poly_invntt_add_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU],
+                                 poly *b, const poly *e)
+{
+  POLY_BOUND(e, MLKEM_ETA1 + 1);
+  poly_invntt_add_compress_du_native(r, b, e);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DU */
+
+#if !defined(MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV)
+void poly_invntt_add_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV],
+                                 poly *a, const poly *e, const poly *m)
+{
+  poly_invntt_tomont(a);
+  poly_add(a, e);
+  poly_add(a, m);
+  poly_reduce(a);
+  poly_compress_dv(r, a);
+}
+#else  /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV */
+void poly_invntt_add_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV],
+                                 poly *a, const poly *e, const poly *m)
+{
+  POLY_BOUND(e, MLKEM_ETA2 + 1);
+  POLY_UBOUND(m, MLKEM_Q);
+  poly_invntt_add_compress_dv_native(r, a, e, m);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_INVNTT_ADD_COMPRESS_DV */
 
 #if !defined(MLKEM_USE_NATIVE_POLY_TOBYTES)
 void poly_tobytes(uint8_t r[MLKEM_POLYBYTES], const poly *a)
@@ -315,6 +397,33 @@ void poly_frombytes(poly *r, const uint8_t a[MLKEM_POLYBYTES])
 }
 #endif /* MLKEM_USE_NATIVE_POLY_FROMBYTES */
 
+#if !defined(MLKEM_USE_NATIVE_POLY_MODULUS_CHECK)
+int poly_modulus_check(const uint8_t a[MLKEM_POLYBYTES])
+{
+  int i;
+  uint32_t fail = 0;
+  for (i = 0; i < MLKEM_N / 2; i++)
+  __loop__(invariant(i >= 0 && i <= MLKEM_N / 2))
+  {
+    const uint32_t t0 = a[3 * i + 0] | ((uint32_t)(a[3 * i + 1] & 0xF) << 8);
+    const uint32_t t1 = (a[3 * i + 1] >> 4) | ((uint32_t)a[3 * i + 2] << 4);
+    /*
+     * t0, t1 <= 4095, so MLKEM_Q - 1 - t wraps around, setting the top
+     * bit, precisely if t >= MLKEM_Q. Accumulating the result rather
+     * than exiting early keeps the loop branch-free and vectorizable.
+     */
+    fail |= (MLKEM_Q - 1 - t0) | (MLKEM_Q - 1 - t1);
+  }
+  return (fail >> 31) ? -1 : 0;
+}
+#else  /* MLKEM_USE_NATIVE_POLY_MODULUS_CHECK */
+int poly_modulus_check(const uint8_t a[MLKEM_POLYBYTES])
+{
+  return poly_modulus_check_native(a) ? -1 : 0;
+}
+#endif /* MLKEM_USE_NATIVE_POLY_MODULUS_CHECK */
+
+#if !defined(MLKEM_USE_NATIVE_POLY_FROMMSG)
 void poly_frommsg(poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES])
 {
   int i;
@@ -340,7 +449,15 @@ void poly_frommsg(poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES])
   }
   POLY_BOUND_MSG(r, MLKEM_Q, "poly_frommsg output");
 }
+#else  /* MLKEM_USE_NATIVE_POLY_FROMMSG */
+void poly_frommsg(poly *r, const uint8_t msg[MLKEM_INDCPA_MSGBYTES])
+{
+  poly_frommsg_native(r, msg);
+  POLY_BOUND_MSG(r, MLKEM_Q, "poly_frommsg output");
+}
+#endif /* MLKEM_USE_NATIVE_POLY_FROMMSG */
 
+#if !defined(MLKEM_USE_NATIVE_POLY_TOMSG)
 void poly_tomsg(uint8_t msg[MLKEM_INDCPA_MSGBYTES], const poly *a)
 {
   int i;
@@ -360,6 +477,13 @@ void poly_tomsg(uint8_t msg[MLKEM_INDCPA_MSGBYTES], const poly *a)
     }
   }
 }
+#else  /* MLKEM_USE_NATIVE_POLY_TOMSG */
+void poly_tomsg(uint8_t msg[MLKEM_INDCPA_MSGBYTES], const poly *a)
+{
+  POLY_UBOUND(a, MLKEM_Q);
+  poly_tomsg_native(msg, a);
+}
+#endif /* MLKEM_USE_NATIVE_POLY_TOMSG */
 
 void poly_getnoise_eta1_4x(poly *r0, poly *r1, poly *r2, poly *r3,
                            const uint8_t seed[MLKEM_SYMBYTES], uint8_t nonce0,
@@ -441,6 +565,58 @@ void poly_getnoise_eta1122_4x(poly *r0, poly *r1, poly *r2, poly *r3,
   POLY_BOUND_MSG(r3, MLKEM_ETA2 + 1, "poly_getnoise_eta1122_4x output 3");
 }
 
+void poly_getnoise_eta1_4x_seeds(poly *r, const uint8_t *seed[4],
+                                 uint8_t nonce)
+{
+  ALIGN uint8_t buf[KECCAK_WAY][MLKEM_ETA1 * MLKEM_N / 4];
+  ALIGN uint8_t extkey[KECCAK_WAY][MLKEM_SYMBYTES + 1];
+  memcpy(extkey[0], seed[0], MLKEM_SYMBYTES);
+  memcpy(extkey[1], seed[1], MLKEM_SYMBYTES);
+  memcpy(extkey[2], seed[2], MLKEM_SYMBYTES);
+  memcpy(extkey[3], seed[3], MLKEM_SYMBYTES);
+  extkey[0][MLKEM_SYMBYTES] = nonce;
+  extkey[1][MLKEM_SYMBYTES] = nonce;
+  extkey[2][MLKEM_SYMBYTES] = nonce;
+  extkey[3][MLKEM_SYMBYTES] = nonce;
+  prf_eta1_x4(buf[0], buf[1], buf[2], buf[3], extkey[0], extkey[1], extkey[2],
+              extkey[3]);
+  poly_cbd_eta1(&r[0], buf[0]);
+  poly_cbd_eta1(&r[1], buf[1]);
+  poly_cbd_eta1(&r[2], buf[2]);
+  poly_cbd_eta1(&r[3], buf[3]);
+
+  POLY_BOUND_MSG(&r[0], MLKEM_ETA1 + 1, "poly_getnoise_eta1_4x_seeds output 0");
+  POLY_BOUND_MSG(&r[1], MLKEM_ETA1 + 1, "poly_getnoise_eta1_4x_seeds output 1");
+  POLY_BOUND_MSG(&r[2], MLKEM_ETA1 + 1, "poly_getnoise_eta1_4x_seeds output 2");
+  POLY_BOUND_MSG(&r[3], MLKEM_ETA1 + 1, "poly_getnoise_eta1_4x_seeds output 3");
+}
+
+void poly_getnoise_eta2_4x_seeds(poly *r, const uint8_t *seed[4],
+                                 uint8_t nonce)
+{
+  ALIGN uint8_t buf[KECCAK_WAY][MLKEM_ETA2 * MLKEM_N / 4];
+  ALIGN uint8_t extkey[KECCAK_WAY][MLKEM_SYMBYTES + 1];
+  memcpy(extkey[0], seed[0], MLKEM_SYMBYTES);
+  memcpy(extkey[1], seed[1], MLKEM_SYMBYTES);
+  memcpy(extkey[2], seed[2], MLKEM_SYMBYTES);
+  memcpy(extkey[3], seed[3], MLKEM_SYMBYTES);
+  extkey[0][MLKEM_SYMBYTES] = nonce;
+  extkey[1][MLKEM_SYMBYTES] = nonce;
+  extkey[2][MLKEM_SYMBYTES] = nonce;
+  extkey[3][MLKEM_SYMBYTES] = nonce;
+  prf_eta2_x4(buf[0], buf[1], buf[2], buf[3], extkey[0], extkey[1], extkey[2],
+              extkey[3]);
+  poly_cbd_eta2(&r[0], buf[0]);
+  poly_cbd_eta2(&r[1], buf[1]);
+  poly_cbd_eta2(&r[2], buf[2]);
+  poly_cbd_eta2(&r[3], buf[3]);
+
+  POLY_BOUND_MSG(&r[0], MLKEM_ETA2 + 1, "poly_getnoise_eta2_4x_seeds output 0");
+  POLY_BOUND_MSG(&r[1], MLKEM_ETA2 + 1, "poly_getnoise_eta2_4x_seeds output 1");
+  POLY_BOUND_MSG(&r[2], MLKEM_ETA2 + 1, "poly_getnoise_eta2_4x_seeds output 2");
+  POLY_BOUND_MSG(&r[3], MLKEM_ETA2 + 1, "poly_getnoise_eta2_4x_seeds output 3");
+}
+
 void poly_basemul_montgomery_cached(poly *r, const poly *a, const poly *b,
                                     const poly_mulcache *b_cache)
 {
@@ -347,6 +347,33 @@ __contract__(
   ensures(array_bound(r->coeffs, 0, (MLKEM_N - 1), 0, (MLKEM_Q - 1)))
 );
 
+#define poly_decompress_du_ntt MLKEM_NAMESPACE(poly_decompress_du_ntt)
+/*************************************************
+ * Name:        poly_decompress_du_ntt
+ *
+ * Description: De-serialization and decompression (du bits) of a
+ *              polynomial, followed by its forward NTT.
+ *
+ *              This is equivalent to poly_decompress_du() and poly_ntt()
+ *              in sequence.
+ *
+ * Arguments:   - poly *r: pointer to output polynomial, in NTT domain
+ *              - const uint8_t *a: pointer to input byte array
+ *                                  (of length MLKEM_POLYCOMPRESSEDBYTES_DU)
+ *
+ * Upon return, the coefficients of the output polynomial are bound
+ * by NTT_BOUND in absolute value.
+ *
+ **************************************************/
+void poly_decompress_du_ntt(poly *r,
+                            const uint8_t a[MLKEM_POLYCOMPRESSEDBYTES_DU])
+__contract__(
+  requires(memory_no_alias(a, MLKEM_POLYCOMPRESSEDBYTES_DU))
+  requires(memory_no_alias(r, sizeof(poly)))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_abs_bound(r->coeffs, 0, MLKEM_N - 1, NTT_BOUND - 1))
+);
+
 #define poly_compress_dv MLKEM_NAMESPACE(poly_compress_dv)
 /*************************************************
  * Name:        poly_compress_dv
@@ -392,6 +419,72 @@ __contract__(
   ensures(array_bound(r->coeffs, 0, (MLKEM_N - 1), 0, (MLKEM_Q - 1)))
 );
 
+#define poly_invntt_add_compress_du MLKEM_NAMESPACE(poly_invntt_add_compress_du)
+/*************************************************
+ * Name:        poly_invntt_add_compress_du
+ *
+ * Description: Computes u = invNTT(b) + e and compresses and serializes it
+ *              with du bits per coefficient, as at the end of encryption.
+ *
+ *              This is equivalent to poly_invntt_tomont(), poly_add(),
+ *              poly_reduce() and poly_compress_du() in sequence, but lets
+ *              native backends fuse the last three into a single pass.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *                            (of length MLKEM_POLYCOMPRESSEDBYTES_DU)
+ *              - poly *b: pointer to input polynomial in NTT domain,
+ *                  with arbitrary coefficients in int16_t.
+ *                  Used as scratch space; its contents are undefined
+ *                  on return.
+ *              - const poly *e: pointer to error polynomial, with
+ *                  coefficients bound by MLKEM_ETA1 in absolute value.
+ **************************************************/
+void poly_invntt_add_compress_du(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DU],
+                                 poly *b, const poly *e)
+__contract__(
+  requires(memory_no_alias(r, MLKEM_POLYCOMPRESSEDBYTES_DU))
+  requires(memory_no_alias(b, sizeof(poly)))
+  requires(memory_no_alias(e, sizeof(poly)))
+  requires(array_abs_bound(e->coeffs, 0, MLKEM_N - 1, MLKEM_ETA1))
+  assigns(memory_slice(r, MLKEM_POLYCOMPRESSEDBYTES_DU))
+  assigns(memory_slice(b, sizeof(poly)))
+);
+
+#define poly_invntt_add_compress_dv MLKEM_NAMESPACE(poly_invntt_add_compress_dv)
+/*************************************************
+ * Name:        poly_invntt_add_compress_dv
+ *
+ * Description: Computes v = invNTT(a) + e + m and compresses and serializes
+ *              it with dv bits per coefficient, as at the end of encryption.
+ *
+ *              This is equivalent to poly_invntt_tomont(), two poly_add(),
+ *              poly_reduce() and poly_compress_dv() in sequence, but lets
+ *              native backends fuse the last four into a single pass.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *                            (of length MLKEM_POLYCOMPRESSEDBYTES_DV)
+ *              - poly *a: pointer to input polynomial in NTT domain,
+ *                  with arbitrary coefficients in int16_t.
+ *                  Used as scratch space; its contents are undefined
+ *                  on return.
+ *              - const poly *e: pointer to error polynomial, with
+ *                  coefficients bound by MLKEM_ETA2 in absolute value.
+ *              - const poly *m: pointer to message polynomial, with
+ *                  coefficients in [0,1,..,MLKEM_Q-1].
+ **************************************************/
+void poly_invntt_add_compress_dv(uint8_t r[MLKEM_POLYCOMPRESSEDBYTES_DV],
+                                 poly *a, const poly *e, const poly *m)
+__contract__(
+  requires(memory_no_alias(r, MLKEM_POLYCOMPRESSEDBYTES_DV))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(memory_no_alias(e, sizeof(poly)))
+  requires(memory_no_alias(m, sizeof(poly)))
+  requires(array_abs_bound(e->coeffs, 0, MLKEM_N - 1, MLKEM_ETA2))
+  requires(array_bound(m->coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1)))
+  assigns(memory_slice(r, MLKEM_POLYCOMPRESSEDBYTES_DV))
+  assigns(memory_slice(a, sizeof(poly)))
+);
+
 #define poly_tobytes MLKEM_NAMESPACE(poly_tobytes)
 /*************************************************
  * Name:        poly_tobytes
@@ -439,6 +532,30 @@ __contract__(
 );
 
 
+#define poly_modulus_check MLKEM_NAMESPACE(poly_modulus_check)
+/*************************************************
+ * Name:        poly_modulus_check
+ *
+ * Description: Checks that a serialized polynomial is canonical,
+ *              i.e. that all of its 12-bit packed coefficients are
+ *              in the range 0 .. MLKEM_Q-1, without unpacking it.
+ *
+ *              This is not constant-time and must only be used on
+ *              public data.
+ *
+ * Arguments:   INPUT
+ *              - a: pointer to input byte array
+ *                   (of MLKEM_POLYBYTES bytes)
+ *
+ * Returns 0 if all coefficients are in range, and -1 otherwise.
+ **************************************************/
+int poly_modulus_check(const uint8_t a[MLKEM_POLYBYTES])
+__contract__(
+  requires(memory_no_alias(a, MLKEM_POLYBYTES))
+  ensures(return_value == 0 || return_value == -1)
+);
+
+
 #define poly_frommsg MLKEM_NAMESPACE(poly_frommsg)
 /*************************************************
  * Name:        poly_frommsg
@@ -605,6 +722,71 @@ __contract__(
      && array_abs_bound(r3->coeffs,0, MLKEM_N - 1, MLKEM_ETA2));
 );
 
+#define poly_getnoise_eta1_4x_seeds MLKEM_NAMESPACE(poly_getnoise_eta1_4x_seeds)
+/*************************************************
+ * Name:        poly_getnoise_eta1_4x_seeds
+ *
+ * Description: Batch sample four polynomials deterministically from four
+ * independent seeds and a common nonce, with output polynomials close to
+ * centered binomial distribution with parameter MLKEM_ETA1.
+ *
+ * This is used to sample the same noise polynomial for four independent
+ * key generations or encapsulations in parallel.
+ *
+ * Arguments:   - poly *r: pointer to output array of four polynomials
+ *              - const uint8_t *seed[4]: pointers to input seeds
+ *                                     (of length MLKEM_SYMBYTES bytes)
+ *              - uint8_t nonce: one-byte input nonce
+ **************************************************/
+void poly_getnoise_eta1_4x_seeds(poly *r, const uint8_t *seed[4],
+                                 uint8_t nonce)
+/* The seeds may belong to the same object, so we only require them
+   to be readable. */
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly) * 4))
+  requires(memory_no_alias(seed, sizeof(uint8_t *) * 4))
+  requires(readable(seed[0], MLKEM_SYMBYTES))
+  requires(readable(seed[1], MLKEM_SYMBYTES))
+  requires(readable(seed[2], MLKEM_SYMBYTES))
+  requires(readable(seed[3], MLKEM_SYMBYTES))
+  assigns(memory_slice(r, sizeof(poly) * 4))
+  ensures(array_abs_bound(r[0].coeffs, 0, MLKEM_N - 1, MLKEM_ETA1))
+  ensures(array_abs_bound(r[1].coeffs, 0, MLKEM_N - 1, MLKEM_ETA1))
+  ensures(array_abs_bound(r[2].coeffs, 0, MLKEM_N - 1, MLKEM_ETA1))
+  ensures(array_abs_bound(r[3].coeffs, 0, MLKEM_N - 1, MLKEM_ETA1))
+);
+
+#define poly_getnoise_eta2_4x_seeds MLKEM_NAMESPACE(poly_getnoise_eta2_4x_seeds)
+/*************************************************
+ * Name:        poly_getnoise_eta2_4x_seeds
+ *
+ * Description: Batch sample four polynomials deterministically from four
+ * independent seeds and a common nonce, with output polynomials close to
+ * centered binomial distribution with parameter MLKEM_ETA2.
+ *
+ * Arguments:   - poly *r: pointer to output array of four polynomials
+ *              - const uint8_t *seed[4]: pointers to input seeds
+ *                                     (of length MLKEM_SYMBYTES bytes)
+ *              - uint8_t nonce: one-byte input nonce
+ **************************************************/
+void poly_getnoise_eta2_4x_seeds(poly *r, const uint8_t *seed[4],
+                                 uint8_t nonce)
+/* The seeds may belong to the same object, so we only require them
+   to be readable. */
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly) * 4))
+  requires(memory_no_alias(seed, sizeof(uint8_t *) * 4))
+  requires(readable(seed[0], MLKEM_SYMBYTES))
+  requires(readable(seed[1], MLKEM_SYMBYTES))
+  requires(readable(seed[2], MLKEM_SYMBYTES))
+  requires(readable(seed[3], MLKEM_SYMBYTES))
+  assigns(memory_slice(r, sizeof(poly) * 4))
+  ensures(array_abs_bound(r[0].coeffs, 0, MLKEM_N - 1, MLKEM_ETA2))
+  ensures(array_abs_bound(r[1].coeffs, 0, MLKEM_N - 1, MLKEM_ETA2))
+  ensures(array_abs_bound(r[2].coeffs, 0, MLKEM_N - 1, MLKEM_ETA2))
+  ensures(array_abs_bound(r[3].coeffs, 0, MLKEM_N - 1, MLKEM_ETA2))
+);
+
 #define poly_basemul_montgomery_cached \
   MLKEM_NAMESPACE(poly_basemul_montgomery_cached)
 /*************************************************
@@ -22,6 +22,17 @@ void polyvec_compress_du(uint8_t r[MLKEM_POLYVECCOMPRESSEDBYTES_DU],
   }
 }
 
+void polyvec_invntt_add_compress_du(
+    uint8_t r[MLKEM_POLYVECCOMPRESSEDBYTES_DU], polyvec *b, const polyvec *e)
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    poly_invntt_add_compress_du(r + i * MLKEM_POLYCOMPRESSEDBYTES_DU,
+                                &b->vec[i], &e->vec[i]);
+  }
+}
+
 void polyvec_decompress_du(polyvec *r,
                            const uint8_t a[MLKEM_POLYVECCOMPRESSEDBYTES_DU])
 {
@@ -34,6 +45,18 @@ void polyvec_decompress_du(polyvec *r,
   POLYVEC_UBOUND(r, MLKEM_Q);
 }
 
+void polyvec_decompress_du_ntt(polyvec *r,
+                               const uint8_t a[MLKEM_POLYVECCOMPRESSEDBYTES_DU])
+{
+  unsigned int i;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    poly_decompress_du_ntt(&r->vec[i], a + i * MLKEM_POLYCOMPRESSEDBYTES_DU);
+  }
+
+  POLYVEC_BOUND(r, NTT_BOUND);
+}
+
 void polyvec_tobytes(uint8_t r[MLKEM_POLYVECBYTES], const polyvec *a)
 {
   unsigned int i;
@@ -52,6 +75,16 @@ void polyvec_frombytes(polyvec *r, const uint8_t a[MLKEM_POLYVECBYTES])
   }
 }
 
+int polyvec_modulus_check(const uint8_t a[MLKEM_POLYVECBYTES])
+{
+  int i, fail = 0;
+  for (i = 0; i < MLKEM_K; i++)
+  {
+    fail |= poly_modulus_check(a + i * MLKEM_POLYBYTES);
+  }
+  return fail;
+}
+
 void polyvec_ntt(polyvec *r)
 {
   unsigned int i;
@@ -116,12 +149,21 @@ void polyvec_basemul_acc_montgomery_cached(poly *r, const polyvec *a,
 }
 #endif /* MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY_CACHED */
 
+#if !defined(MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY)
 void polyvec_basemul_acc_montgomery(poly *r, const polyvec *a, const polyvec *b)
 {
   polyvec_mulcache b_cache;
   polyvec_mulcache_compute(&b_cache, b);
   polyvec_basemul_acc_montgomery_cached(r, a, b, &b_cache);
 }
+#else  /* !MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY */
+void polyvec_basemul_acc_montgomery(poly *r, const polyvec *a, const polyvec *b)
+{
+  POLYVEC_BOUND(a, 4096);
+  POLYVEC_BOUND(b, NTT_BOUND);
+  polyvec_basemul_acc_montgomery_native(r, a, b);
+}
+#endif /* MLKEM_USE_NATIVE_POLYVEC_BASEMUL_ACC_MONTGOMERY */
 
 void polyvec_mulcache_compute(polyvec_mulcache *x, const polyvec *a)
 {
@@ -41,6 +41,34 @@ __contract__(
   assigns(object_whole(r))
 );
 
+#define polyvec_invntt_add_compress_du \
+  MLKEM_NAMESPACE(polyvec_invntt_add_compress_du)
+/*************************************************
+ * Name:        polyvec_invntt_add_compress_du
+ *
+ * Description: Applies poly_invntt_add_compress_du() to each element of
+ *              a vector of polynomials, producing the compressed and
+ *              serialized vector u = invNTT(b) + e.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *                            (needs space for MLKEM_POLYVECCOMPRESSEDBYTES_DU)
+ *              - polyvec *b: pointer to input vector in NTT domain.
+ *                            Used as scratch space.
+ *              - const polyvec *e: pointer to error vector, with
+ *                  coefficients bound by MLKEM_ETA1 in absolute value.
+ **************************************************/
+void polyvec_invntt_add_compress_du(
+    uint8_t r[MLKEM_POLYVECCOMPRESSEDBYTES_DU], polyvec *b, const polyvec *e)
+__contract__(
+  requires(memory_no_alias(r, MLKEM_POLYVECCOMPRESSEDBYTES_DU))
+  requires(memory_no_alias(b, sizeof(polyvec)))
+  requires(memory_no_alias(e, sizeof(polyvec)))
+  requires(forall(int, k0, 0, MLKEM_K - 1,
+         array_abs_bound(e->vec[k0].coeffs, 0, MLKEM_N - 1, MLKEM_ETA1)))
+  assigns(object_whole(r))
+  assigns(object_whole(b))
+);
+
 #define polyvec_decompress_du MLKEM_NAMESPACE(polyvec_decompress_du)
 /*************************************************
  * Name:        polyvec_decompress_du
@@ -63,6 +91,29 @@ __contract__(
          array_bound(r->vec[k0].coeffs, 0, (MLKEM_N - 1), 0, (MLKEM_Q - 1))))
 );
 
+#define polyvec_decompress_du_ntt MLKEM_NAMESPACE(polyvec_decompress_du_ntt)
+/*************************************************
+ * Name:        polyvec_decompress_du_ntt
+ *
+ * Description: Applies poly_decompress_du_ntt() to each element of a
+ *              vector of polynomials, i.e. de-serializes and decompresses
+ *              the vector u of a ciphertext and transforms it to NTT domain.
+ *
+ * Arguments:   - polyvec *r:       pointer to output vector of polynomials.
+ *                Output is in NTT domain, bound by NTT_BOUND.
+ *              - const uint8_t *a: pointer to input byte array
+ *                                  (of length MLKEM_POLYVECCOMPRESSEDBYTES_DU)
+ **************************************************/
+void polyvec_decompress_du_ntt(polyvec *r,
+                               const uint8_t a[MLKEM_POLYVECCOMPRESSEDBYTES_DU])
+__contract__(
+  requires(memory_no_alias(a, MLKEM_POLYVECCOMPRESSEDBYTES_DU))
+  requires(memory_no_alias(r, sizeof(polyvec)))
+  assigns(object_whole(r))
+  ensures(forall(int, k0, 0, MLKEM_K - 1,
+         array_abs_bound(r->vec[k0].coeffs, 0, MLKEM_N - 1, NTT_BOUND - 1)))
+);
+
 #define polyvec_tobytes MLKEM_NAMESPACE(polyvec_tobytes)
 /*************************************************
  * Name:        polyvec_tobytes
@@ -104,6 +155,26 @@ __contract__(
         array_bound(r->vec[k0].coeffs, 0, (MLKEM_N - 1), 0, UINT12_MAX)))
 );
 
+#define polyvec_modulus_check MLKEM_NAMESPACE(polyvec_modulus_check)
+/*************************************************
+ * Name:        polyvec_modulus_check
+ *
+ * Description: Checks that a serialized vector of polynomials is
+ *              canonical, i.e. that all of its 12-bit packed
+ *              coefficients are in the range 0 .. MLKEM_Q-1.
+ *              See poly_modulus_check().
+ *
+ * Arguments:   - const uint8_t *a: pointer to input byte array
+ *                 (of length MLKEM_POLYVECBYTES)
+ *
+ * Returns 0 if all coefficients are in range, and -1 otherwise.
+ **************************************************/
+int polyvec_modulus_check(const uint8_t a[MLKEM_POLYVECBYTES])
+__contract__(
+  requires(memory_no_alias(a, MLKEM_POLYVECBYTES))
+  ensures(return_value == 0 || return_value == -1)
+);
+
 #define polyvec_ntt MLKEM_NAMESPACE(polyvec_ntt)
 /*************************************************
  * Name:        polyvec_ntt
@@ -161,6 +232,10 @@ __contract__(
  * Description: Multiply elements of a and b in NTT domain, accumulate into r,
  *              and multiply by 2^-16.
  *
+ *              Use this when b is only multiplied once: the mulcache for
+ *              b is computed on the fly, or skipped entirely if the native
+ *              backend does not need one.
+ *
  * Arguments: - poly *r: pointer to output polynomial
  *            - const polyvec *a: pointer to first input vector of polynomials
  *            - const polyvec *b: pointer to second input vector of polynomials
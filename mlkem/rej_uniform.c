@@ -5,6 +5,7 @@
 
 #include "rej_uniform.h"
 #include "arith_backend.h"
+#include "fips202.h"
 
 /*************************************************
  * Name:        rej_uniform_scalar
@@ -97,3 +98,16 @@ unsigned int rej_uniform(int16_t *r, unsigned int target, unsigned int offset,
   return rej_uniform_scalar(r, target, offset, buf, buflen);
 }
 #endif /* MLKEM_USE_NATIVE_REJ_UNIFORM */
+
+unsigned int rej_uniform_keccak(int16_t *r, unsigned int target,
+                                unsigned int offset, uint64_t *state)
+{
+#if defined(SYS_LITTLE_ENDIAN)
+  return rej_uniform(r, target, offset, (const uint8_t *)state,
+                     SHAKE128_RATE);
+#else  /* SYS_LITTLE_ENDIAN */
+  uint8_t buf[SHAKE128_RATE];
+  KeccakF1600_StateExtractBytes(state, buf, 0, SHAKE128_RATE);
+  return rej_uniform(r, target, offset, buf, SHAKE128_RATE);
+#endif /* SYS_LITTLE_ENDIAN */
+}
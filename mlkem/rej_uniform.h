@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include "cbmc.h"
 #include "common.h"
+#include "keccakf1600.h"
 
 #define rej_uniform MLKEM_NAMESPACE(rej_uniform)
 /*************************************************
@@ -58,4 +59,40 @@ __contract__(
   ensures(offset <= return_value && return_value <= target)
   ensures(return_value > 0 ==> array_bound(r, 0, return_value - 1, 0, (MLKEM_Q - 1)))
 );
+
+#define rej_uniform_keccak MLKEM_NAMESPACE(rej_uniform_keccak)
+/*************************************************
+ * Name:        rej_uniform_keccak
+ *
+ * Description: Fused XOF squeeze and rejection sampling: runs rej_uniform()
+ *              on the next SHAKE128 output block, that is, on the first
+ *              SHAKE128_RATE bytes of a freshly permuted Keccak state.
+ *
+ *              On little-endian systems the block is read in place, as the
+ *              bytes of a state are its lanes in little-endian order; so
+ *              there is no squeeze buffer. Otherwise, the block is first
+ *              extracted via KeccakF1600_StateExtractBytes().
+ *
+ * Arguments:   - int16_t *r:          pointer to output buffer
+ *              - unsigned int target: requested number of 16-bit integers,
+ *                                     see rej_uniform()
+ *              - unsigned int offset: number of 16-bit integers that have
+ *                                     already been sampled,
+ *                                     see rej_uniform()
+ *              - uint64_t *state:     pointer to Keccak state; may be a
+ *                                     single state of a batched state
+ *
+ * Returns the new offset of sampled 16-bit integers, see rej_uniform().
+ **************************************************/
+unsigned int rej_uniform_keccak(int16_t *r, unsigned int target,
+                                unsigned int offset, uint64_t *state)
+__contract__(
+  requires(offset <= target && target <= 4096)
+  requires(memory_no_alias(r, sizeof(int16_t) * target))
+  requires(memory_no_alias(state, sizeof(uint64_t) * KECCAK_LANES))
+  requires(offset > 0 ==> array_bound(r, 0, offset - 1, 0, (MLKEM_Q - 1)))
+  assigns(memory_slice(r, sizeof(int16_t) * target))
+  ensures(offset <= return_value && return_value <= target)
+  ensures(return_value > 0 ==> array_bound(r, 0, return_value - 1, 0, (MLKEM_Q - 1)))
+);
 #endif
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sampling.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "cbd.h"
+#include "fips202.h"
+#include "fips202_backend.h"
+#include "keccakf1600.h"
+#include "rej_uniform.h"
+#include "symmetric.h"
+
+#include "debug/debug.h"
+
+STATIC_ASSERT(SAMPLE_CBD_NEED(MLKEM_ETA2) <= SAMPLE_BUFLEN, sample_buflen)
+
+/* Lane accessors and permutation of the SAMPLE_WAY-fold state */
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE)
+#define sample_lane_reset KeccakF1600x8_LaneReset
+#define sample_lane_xor KeccakF1600x8_LaneXORBytes
+#define sample_lane_extract KeccakF1600x8_LaneExtractBytes
+#define sample_permute KeccakF1600x8_StatePermute
+#else
+#define sample_lane_reset KeccakF1600x4_LaneReset
+#define sample_lane_xor KeccakF1600x4_LaneXORBytes
+#define sample_lane_extract KeccakF1600x4_LaneExtractBytes
+#define sample_permute KeccakF1600x4_StatePermute
+#endif
+
+/* State of a single lane of the batched Keccak state */
+typedef struct
+{
+  const sample_job *job; /* Job running in this lane, or NULL if idle */
+  unsigned int rate;     /* Rate of the sponge running in this lane */
+  unsigned int buflen;   /* Number of bytes squeezed into the lane buffer */
+  unsigned int need;     /* Number of bytes to squeeze before CBD */
+  unsigned int ctr;      /* Number of coefficients sampled so far */
+} sample_lane;
+
+/* clang-format off */
+/* Invariant of a lane running a job which has not completed yet */
+#define sample_lane_valid(lane)                                               \
+  ((lane)->job->kind == SAMPLE_JOB_UNIFORM                                    \
+   ? ((lane)->rate == SHAKE128_RATE && (lane)->ctr <= MLKEM_N &&              \
+      ((lane)->ctr > 0 ==> array_bound((lane)->job->out->coeffs, 0,           \
+                                       (lane)->ctr - 1, 0, (MLKEM_Q - 1))))   \
+   : ((lane)->rate == SHAKE256_RATE &&                                        \
+      (lane)->buflen % SHAKE256_RATE == 0 &&                                  \
+      (lane)->need % SHAKE256_RATE == 0 &&                                    \
+      (lane)->buflen < (lane)->need && (lane)->need <= SAMPLE_BUFLEN))
+
+/* Lane l of lanes is idle, or runs one of the first next jobs */
+#define sample_lane_ok(lanes, l, jobs, next)                                  \
+  ((lanes)[l].job == NULL ||                                                  \
+   ((jobs) <= (lanes)[l].job && (lanes)[l].job < (jobs) + (next) &&           \
+    sample_lane_valid(&(lanes)[l])))
+
+/* Number of busy lanes. The CBMC proofs use the 4-fold state. */
+#define sample_lanes_busy(lanes)                                              \
+  (((lanes)[0].job != NULL) + ((lanes)[1].job != NULL) +                      \
+   ((lanes)[2].job != NULL) + ((lanes)[3].job != NULL))
+
+/* Scheduler invariant: all lanes are valid and run distinct jobs, lanes
+ * are only idle once all jobs have been started, and all started jobs
+ * that are no longer running are complete. */
+#define sample_jobs_invariant(lanes, jobs, njobs, next, active)               \
+  ((next) <= (njobs) && (active) == sample_lanes_busy(lanes) &&               \
+   forall(unsigned, k, 0, SAMPLE_WAY - 1,                                     \
+     sample_lane_ok(lanes, k, jobs, next) &&                                  \
+     ((next) < (njobs) ==> (lanes)[k].job != NULL)) &&                        \
+   forall(unsigned, k0, 0, SAMPLE_WAY - 1,                                    \
+     forall(unsigned, k1, 0, SAMPLE_WAY - 1,                                  \
+       (k0 == k1 || (lanes)[k0].job == NULL ||                                \
+        (lanes)[k0].job != (lanes)[k1].job))) &&                              \
+   forall(unsigned, i, 0, (njobs) - 1,                                        \
+     (i < (next) &&                                                           \
+      forall(unsigned, k, 0, SAMPLE_WAY - 1, (lanes)[k].job != &(jobs)[i]))   \
+     ==> sample_job_bound(&(jobs)[i])))
+/* clang-format on */
+
+/*
+ * Start a new job in a lane: reset the lane's sponge and absorb
+ * seed || ds, including padding. The input is always shorter than the
+ * rate, so no permutation is needed here.
+ */
+static void sample_lane_start(uint64_t *state, sample_lane *lane,
+                              unsigned int l, const sample_job *job)
+{
+  unsigned int inlen;
+  uint8_t p;
+
+  if (job->kind == SAMPLE_JOB_UNIFORM)
+  {
+    lane->rate = SHAKE128_RATE;
+    lane->need = 0;
+    inlen = MLKEM_SYMBYTES + 2;
+  }
+  else
+  {
+    lane->rate = SHAKE256_RATE;
+    lane->need = (job->kind == SAMPLE_JOB_CBD_ETA1)
+                     ? SAMPLE_CBD_NEED(MLKEM_ETA1)
+                     : SAMPLE_CBD_NEED(MLKEM_ETA2);
+    inlen = MLKEM_SYMBYTES + 1;
+  }
+
+  lane->job = job;
+  lane->buflen = 0;
+  lane->ctr = 0;
+
+  sample_lane_reset(state, l);
+  sample_lane_xor(state, l, job->seed, 0, MLKEM_SYMBYTES);
+  sample_lane_xor(state, l, job->ds, MLKEM_SYMBYTES, inlen - MLKEM_SYMBYTES);
+
+  /* SHAKE domain separator and pad10*1; inlen < rate - 1 */
+  p = 0x1F;
+  sample_lane_xor(state, l, &p, inlen, 1);
+  p = 128;
+  sample_lane_xor(state, l, &p, lane->rate - 1, 1);
+}
+
+/*
+ * Consume the output block of lane l that the last permutation produced.
+ * Returns 1 if the job running in the lane is complete, and 0 if more
+ * output needs to be squeezed.
+ */
+static int sample_lane_process(uint64_t *state, sample_lane *lane,
+                               unsigned int l, uint8_t *buf)
+{
+  poly *out = lane->job->out;
+
+  if (lane->job->kind == SAMPLE_JOB_UNIFORM)
+  {
+    /* Fused squeeze + sample, one block at a time */
+    lane->ctr = rej_uniform_keccak(out->coeffs, MLKEM_N, lane->ctr,
+                                   state + KECCAK_LANES * l);
+    if (lane->ctr < MLKEM_N)
+    {
+      return 0;
+    }
+    POLY_UBOUND(out, MLKEM_Q);
+    return 1;
+  }
+
+  sample_lane_extract(state, l, buf + lane->buflen, 0, lane->rate);
+  lane->buflen += lane->rate;
+  if (lane->buflen < lane->need)
+  {
+    return 0;
+  }
+
+  if (lane->job->kind == SAMPLE_JOB_CBD_ETA1)
+  {
+    poly_cbd_eta1(out, buf);
+    POLY_BOUND_MSG(out, MLKEM_ETA1 + 1, "sample_jobs eta1 output");
+  }
+  else
+  {
+    poly_cbd_eta2(out, buf);
+    POLY_BOUND_MSG(out, MLKEM_ETA2 + 1, "sample_jobs eta2 output");
+  }
+  return 1;
+}
+
+void sample_jobs_ws(const sample_job *jobs, unsigned int njobs,
+                    sample_workspace *ws)
+{
+  sample_lane lanes[SAMPLE_WAY];
+  unsigned int l, next = 0, active = 0;
+
+  for (l = 0; l < SAMPLE_WAY; l++)
+  __loop__(
+    assigns(l, next, active, object_whole(lanes),
+            memory_slice(ws, sizeof(sample_workspace)))
+    invariant(l <= SAMPLE_WAY && next <= l && next <= njobs)
+    invariant(active == next && (next < njobs ==> next == l))
+    invariant(forall(unsigned, k, 0, SAMPLE_WAY - 1,
+      k < l ==> (lanes[k].job == (k < next ? &jobs[k] : NULL) &&
+                 sample_lane_ok(lanes, k, jobs, next)))))
+  {
+    /* Idle lanes keep permuting a zero state, which is harmless */
+    sample_lane_reset(ws->state, l);
+    lanes[l].job = NULL;
+    if (next < njobs)
+    {
+      sample_lane_start(ws->state, &lanes[l], l, &jobs[next++]);
+      active++;
+    }
+  }
+
+  while (active > 0)
+  __loop__(
+    assigns(l, next, active, object_whole(lanes),
+            memory_slice(ws, sizeof(sample_workspace)),
+            object_whole(jobs[0].out))
+    invariant(sample_jobs_invariant(lanes, jobs, njobs, next, active)))
+  {
+    sample_permute(ws->state);
+
+    for (l = 0; l < SAMPLE_WAY; l++)
+    __loop__(
+      assigns(l, next, active, object_whole(lanes),
+              memory_slice(ws, sizeof(sample_workspace)),
+              object_whole(jobs[0].out))
+      invariant(l <= SAMPLE_WAY)
+      invariant(sample_jobs_invariant(lanes, jobs, njobs, next, active)))
+    {
+      sample_lane *lane = &lanes[l];
+      if (lane->job == NULL)
+      {
+        continue;
+      }
+
+      if (!sample_lane_process(ws->state, lane, l, ws->buf[l]))
+      {
+        continue;
+      }
+
+      /* Job complete: refill the lane with the next pending job, if any */
+      if (next < njobs)
+      {
+        sample_lane_start(ws->state, lane, l, &jobs[next++]);
+      }
+      else
+      {
+        lane->job = NULL;
+        active--;
+      }
+    }
+  }
+}
+
+void sample_jobs(const sample_job *jobs, unsigned int njobs)
+{
+  sample_workspace ws;
+  sample_jobs_ws(jobs, njobs, &ws);
+}
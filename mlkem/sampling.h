@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 The mlkem-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include <stdint.h>
+#include "cbmc.h"
+#include "common.h"
+#include "keccakf1600.h"
+#include "poly.h"
+#include "symmetric.h"
+
+/* Kinds of sampling jobs handled by sample_jobs() */
+#define SAMPLE_JOB_UNIFORM 0  /* SHAKE128 + rejection sampling (matrix A) */
+#define SAMPLE_JOB_CBD_ETA1 1 /* SHAKE256 + CBD with parameter MLKEM_ETA1 */
+#define SAMPLE_JOB_CBD_ETA2 2 /* SHAKE256 + CBD with parameter MLKEM_ETA2 */
+
+/* Maximum number of jobs passed to sample_jobs(): matrix and noise
+ * polynomials of indcpa_enc() */
+#define SAMPLE_JOBS_MAX (MLKEM_K * MLKEM_K + 2 * MLKEM_K + 1)
+
+/* Number of PRF output bytes needed for CBD with parameter ETA,
+ * rounded up to a multiple of the SHAKE256 rate */
+#define SAMPLE_CBD_NEED(ETA) \
+  (((ETA) * MLKEM_N / 4 + SHAKE256_RATE - 1) / SHAKE256_RATE * SHAKE256_RATE)
+
+/*
+ * Size of the per-lane buffer collecting squeezed PRF output.
+ * Uniform sampling does not need one: it reads each block straight
+ * from the Keccak state, see rej_uniform_keccak().
+ */
+#define SAMPLE_BUFLEN SAMPLE_CBD_NEED(MLKEM_ETA1)
+
+/* Run the scheduler on an 8-fold state if the FIPS202 backend has a native
+ * 8-fold permutation, and on a 4-fold state otherwise. */
+#if defined(MLKEM_USE_FIPS202_X8_NATIVE)
+#define SAMPLE_WAY 8
+#else
+#define SAMPLE_WAY KECCAK_WAY
+#endif
+
+/* With runtime dispatch, the public API only sees the workspace layout
+ * of the build without a backend, so size it for the 8-fold state any
+ * of the dispatched backends may use, see dispatch.h. */
+#if defined(MLKEM_NATIVE_DISPATCH)
+#define SAMPLE_WAY_MAX 8
+#else
+#define SAMPLE_WAY_MAX SAMPLE_WAY
+#endif
+
+/*
+ * Scratch space of sample_jobs_ws(). Callers with a workspace of their
+ * own can overlay it with temporaries that are only needed after
+ * sampling, see indcpa.h.
+ */
+typedef struct
+{
+  uint64_t state[KECCAK_LANES * SAMPLE_WAY_MAX];
+  ALIGN uint8_t buf[SAMPLE_WAY_MAX][SAMPLE_BUFLEN];
+} sample_workspace;
+
+/*
+ * A single polynomial sampling job.
+ *
+ * The Keccak input is seed[0..MLKEM_SYMBYTES-1] followed by ds[0] and,
+ * for SAMPLE_JOB_UNIFORM only, ds[1].
+ */
+typedef struct
+{
+  poly *out;
+  const uint8_t *seed;
+  uint8_t ds[2];
+  uint8_t kind;
+} sample_job;
+
+/*************************************************
+ * Name:        sample_job_uniform
+ *
+ * Description: Set up a job sampling a polynomial with coefficients
+ *              uniform mod q from SHAKE128(seed || x || y).
+ **************************************************/
+static INLINE void sample_job_uniform(sample_job *job, poly *out,
+                                      const uint8_t seed[MLKEM_SYMBYTES],
+                                      uint8_t x, uint8_t y)
+{
+  job->out = out;
+  job->seed = seed;
+  job->ds[0] = x;
+  job->ds[1] = y;
+  job->kind = SAMPLE_JOB_UNIFORM;
+}
+
+/*************************************************
+ * Name:        sample_job_cbd
+ *
+ * Description: Set up a job sampling a noise polynomial from
+ *              SHAKE256(seed || nonce). kind must be SAMPLE_JOB_CBD_ETA1
+ *              or SAMPLE_JOB_CBD_ETA2.
+ **************************************************/
+static INLINE void sample_job_cbd(sample_job *job, poly *out,
+                                  const uint8_t seed[MLKEM_SYMBYTES],
+                                  uint8_t nonce, uint8_t kind)
+{
+  job->out = out;
+  job->seed = seed;
+  job->ds[0] = nonce;
+  job->ds[1] = 0;
+  job->kind = kind;
+}
+
+/* clang-format off */
+/* Bound on the output of a completed sampling job */
+#define sample_job_bound(job)                                                \
+  (((job)->kind == SAMPLE_JOB_UNIFORM ==>                                    \
+    array_bound((job)->out->coeffs, 0, MLKEM_N - 1, 0, (MLKEM_Q - 1))) &&    \
+   ((job)->kind == SAMPLE_JOB_CBD_ETA1 ==>                                   \
+    array_abs_bound((job)->out->coeffs, 0, MLKEM_N - 1, MLKEM_ETA1)) &&      \
+   ((job)->kind == SAMPLE_JOB_CBD_ETA2 ==>                                   \
+    array_abs_bound((job)->out->coeffs, 0, MLKEM_N - 1, MLKEM_ETA2)))
+/* clang-format on */
+
+#define sample_jobs MLKEM_NAMESPACE(sample_jobs)
+/*************************************************
+ * Name:        sample_jobs
+ *
+ * Description: Run a list of sampling jobs on a single batched Keccak state.
+ *              The state is 8-fold if the FIPS202 backend provides a native
+ *              8-fold permutation (MLKEM_USE_FIPS202_X8_NATIVE), and 4-fold
+ *              otherwise.
+ *
+ *              Every lane of the state runs its own sponge, so SHAKE128 and
+ *              SHAKE256 jobs can share a permutation. Whenever a lane
+ *              finishes its job, the next pending job is started in that
+ *              lane, so lanes only run idle once the list is exhausted.
+ *
+ *              Jobs are started in list order; callers should list longer
+ *              jobs (SAMPLE_JOB_UNIFORM) first so that the short noise
+ *              jobs fill up the tail.
+ *
+ *              Outputs of SAMPLE_JOB_UNIFORM jobs have coefficients in
+ *              [0,..,q-1] and are in bitreversed order, like the output of
+ *              gen_matrix() before poly_permute_bitrev_to_custom().
+ *              Outputs of SAMPLE_JOB_CBD_ETA{1,2} jobs have coefficients
+ *              bound by MLKEM_ETA{1,2} in absolute value.
+ *
+ * Arguments:   - const sample_job *jobs: pointer to list of jobs
+ *              - unsigned int njobs:     number of jobs
+ **************************************************/
+void sample_jobs(const sample_job *jobs, unsigned int njobs)
+__contract__(
+  /* The outputs of all jobs are disjoint polynomials within a single
+   * object, which is all that is written; all callers sample into
+   * (parts of) one workspace or matrix. */
+  requires(0 < njobs && njobs <= SAMPLE_JOBS_MAX)
+  requires(memory_no_alias(jobs, sizeof(sample_job) * njobs))
+  requires(forall(unsigned, i, 0, njobs - 1,
+    jobs[i].kind <= SAMPLE_JOB_CBD_ETA2 &&
+    same_object(jobs[i].out, jobs[0].out) &&
+    writeable(jobs[i].out, sizeof(poly)) &&
+    readable(jobs[i].seed, MLKEM_SYMBYTES) &&
+    !same_object(jobs[i].seed, jobs[0].out) &&
+    !same_object(jobs[i].seed, jobs)))
+  requires(forall(unsigned, i, 0, njobs - 1,
+    forall(unsigned, j, 0, njobs - 1,
+      i == j || jobs[i].out + 1 <= jobs[j].out ||
+                jobs[j].out + 1 <= jobs[i].out)))
+  assigns(object_whole(jobs[0].out))
+  ensures(forall(unsigned, i, 0, njobs - 1, sample_job_bound(&jobs[i])))
+);
+
+#define sample_jobs_ws MLKEM_NAMESPACE(sample_jobs_ws)
+/*************************************************
+ * Name:        sample_jobs_ws
+ *
+ * Description: As sample_jobs(), but with the batched Keccak state and
+ *              the lane buffers in a caller-provided workspace.
+ *
+ * Arguments:   - const sample_job *jobs: pointer to list of jobs
+ *              - unsigned int njobs:     number of jobs
+ *              - sample_workspace *ws:   pointer to workspace
+ **************************************************/
+void sample_jobs_ws(const sample_job *jobs, unsigned int njobs,
+                    sample_workspace *ws)
+__contract__(
+  /* As for sample_jobs(); in addition, the scratch space may share
+   * an object with the outputs, but must not overlap any of them. */
+  requires(0 < njobs && njobs <= SAMPLE_JOBS_MAX)
+  requires(memory_no_alias(jobs, sizeof(sample_job) * njobs))
+  requires(forall(unsigned, i, 0, njobs - 1,
+    jobs[i].kind <= SAMPLE_JOB_CBD_ETA2 &&
+    same_object(jobs[i].out, jobs[0].out) &&
+    writeable(jobs[i].out, sizeof(poly)) &&
+    readable(jobs[i].seed, MLKEM_SYMBYTES) &&
+    !same_object(jobs[i].seed, jobs[0].out) &&
+    !same_object(jobs[i].seed, jobs)))
+  requires(forall(unsigned, i, 0, njobs - 1,
+    forall(unsigned, j, 0, njobs - 1,
+      i == j || jobs[i].out + 1 <= jobs[j].out ||
+                jobs[j].out + 1 <= jobs[i].out)))
+  requires(memory_no_alias(ws, sizeof(sample_workspace)))
+  requires(forall(unsigned, i, 0, njobs - 1,
+    !same_object(jobs[i].seed, ws) &&
+    (!same_object(jobs[i].out, ws) ||
+     (uint8_t *)(jobs[i].out + 1) <= (uint8_t *)ws ||
+     (uint8_t *)(ws + 1) <= (uint8_t *)jobs[i].out)))
+  assigns(object_whole(jobs[0].out))
+  assigns(memory_slice(ws, sizeof(sample_workspace)))
+  ensures(forall(unsigned, i, 0, njobs - 1, sample_job_bound(&jobs[i])))
+);
+
+#endif
@@ -10,6 +10,7 @@
 #include "cbmc.h"
 #include "common.h"
 #include "fips202.h"
+#include "fips202x4.h"
 
 /* Macros denoting FIPS-203 specific Hash functions */
 
@@ -22,6 +23,45 @@
 /* Hash function J, FIPS-203 4.1 (eq 4.4) */
 #define hash_j(OUT, IN, INBYTES) shake256(OUT, MLKEM_SYMBYTES, IN, INBYTES)
 
+/* Four-way parallel variants of H, G and J. */
+#define hash_h_x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3, INBYTES) \
+  sha3_256x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3, INBYTES)
+#define hash_g_x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3, INBYTES) \
+  sha3_512x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3, INBYTES)
+#define hash_j_x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3, INBYTES)   \
+  shake256x4(OUT0, OUT1, OUT2, OUT3, MLKEM_SYMBYTES, IN0, IN1, IN2, IN3, \
+             INBYTES)
+
+/*
+ * Incremental variants of G and J, for inputs that are not contiguous
+ * in memory: init, then absorb any number of chunks, then finalize.
+ */
+#define hash_g_ctx sha3_512incctx
+#define hash_g_init(CTX) sha3_512_inc_init(CTX)
+#define hash_g_absorb(CTX, IN, INBYTES) sha3_512_inc_absorb(CTX, IN, INBYTES)
+#define hash_g_finalize(OUT, CTX) sha3_512_inc_finalize(OUT, CTX)
+
+#define hash_j_ctx shake256incctx
+#define hash_j_init(CTX) shake256_inc_init(CTX)
+#define hash_j_absorb(CTX, IN, INBYTES) shake256_inc_absorb(CTX, IN, INBYTES)
+#define hash_j_finalize(OUT, CTX)                   \
+  do                                                \
+  {                                                 \
+    shake256_inc_finalize(CTX);                     \
+    shake256_inc_squeeze(OUT, MLKEM_SYMBYTES, CTX); \
+  } while (0)
+
+#define hash_j_x4_ctx shake256x4incctx
+#define hash_j_x4_init(CTX) shake256x4_inc_init(CTX)
+#define hash_j_x4_absorb(CTX, IN0, IN1, IN2, IN3, INBYTES) \
+  shake256x4_inc_absorb(CTX, IN0, IN1, IN2, IN3, INBYTES)
+#define hash_j_x4_finalize(OUT0, OUT1, OUT2, OUT3, CTX)                  \
+  do                                                                     \
+  {                                                                      \
+    shake256x4_inc_finalize(CTX);                                        \
+    shake256x4_inc_squeeze(OUT0, OUT1, OUT2, OUT3, MLKEM_SYMBYTES, CTX); \
+  } while (0)
+
 /* PRF function, FIPS-203 4.1 (eq 4.3)
  * Referring to (eq 4.3), `OUT` is assumed to contain `s || b`. */
 #define prf_eta(ETA, OUT, IN) \
@@ -31,6 +71,9 @@
 #define prf_eta1_x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3)            \
   shake256x4(OUT0, OUT1, OUT2, OUT3, (MLKEM_ETA1 * MLKEM_N / 4), IN0, IN1, \
              IN2, IN3, MLKEM_SYMBYTES + 1)
+#define prf_eta2_x4(OUT0, OUT1, OUT2, OUT3, IN0, IN1, IN2, IN3)            \
+  shake256x4(OUT0, OUT1, OUT2, OUT3, (MLKEM_ETA2 * MLKEM_N / 4), IN0, IN1, \
+             IN2, IN3, MLKEM_SYMBYTES + 1)
 
 /* XOF function, FIPS-203 4.1 */
 #define xof_ctx shake128ctx
@@ -41,12 +84,22 @@
   shake128_squeezeblocks((BUF), (NBLOCKS), (CTX))
 #define xof_release(CTX) shake128_release((CTX))
 
+/*
+ * Squeeze one block into the XOF state itself, for consumers that read
+ * the output in place, such as rej_uniform_keccak().
+ */
+#define xof_permute(CTX) KeccakF1600_StatePermute((CTX)->ctx)
+#define xof_state(CTX) ((CTX)->ctx)
+
 #define xof_x4_absorb(CTX, IN0, IN1, IN2, IN3, INBYTES) \
   shake128x4_absorb_once((CTX), (IN0), (IN1), (IN2), (IN3), (INBYTES))
 #define xof_x4_squeezeblocks(BUF0, BUF1, BUF2, BUF3, NBLOCKS, CTX) \
   shake128x4_squeezeblocks((BUF0), (BUF1), (BUF2), (BUF3), (NBLOCKS), (CTX))
 #define xof_x4_release(CTX) shake128x4_release((CTX))
 
+#define xof_x4_permute(CTX) KeccakF1600x4_StatePermute((CTX)->ctx)
+#define xof_x4_state(CTX, L) ((CTX)->ctx + KECCAK_LANES * (L))
+
 #define XOF_RATE SHAKE128_RATE
 
 #endif /* SYMMETRIC_H */
@@ -530,6 +530,133 @@ def gen_avx2_fwd_ntt_zeta_file(dry_run=False):
     )
 
 
+def gen_avx512_ntt_zetas():
+    """Generate the twiddle table used by the AVX-512 NTT, invNTT and
+    mulcache computation. Every entry is a vector of 32 int16 values;
+    constants for Montgomery multiplication come in pairs of the twisted
+    constant followed by the constant itself."""
+
+    zetas = list(gen_c_zetas())
+
+    def twist(x):
+        return signed_reduce_u16(x * pow(modulus, -1, 2**16))
+
+    def vec(vals):
+        assert len(vals) == 32
+        yield from map(twist, vals)
+        yield from vals
+
+    def blocks(idxs, repeat):
+        return [zetas[i] for i in idxs for _ in range(repeat)]
+
+    # Layers 1-3 (len 128, 64, 32) use broadcasts of zetas[1..7]
+    scalars = zetas[1:8] + [0] * 9
+    yield from scalars
+    yield from map(twist, scalars)
+
+    # Forward layers 4-7, for the m-th pair of vectors (see ntt_avx512.c)
+    for m in range(4):
+        yield from vec(blocks(range(8 + 2 * m, 10 + 2 * m), 16))
+        yield from vec(blocks(range(16 + 4 * m, 20 + 4 * m), 8))
+        yield from vec(blocks(range(32 + 8 * m, 40 + 8 * m), 4))
+        yield from vec(blocks(range(64 + 16 * m, 80 + 16 * m), 2))
+
+    # Inverse layers 7-4, for the m-th pair of vectors
+    for m in range(4):
+        yield from vec(blocks(range(127 - 16 * m, 111 - 16 * m, -1), 2))
+        yield from vec(blocks(range(63 - 8 * m, 55 - 8 * m, -1), 4))
+        yield from vec(blocks(range(31 - 4 * m, 27 - 4 * m, -1), 8))
+        yield from vec(blocks(range(15 - 2 * m, 13 - 2 * m, -1), 16))
+
+    # Mulcache twiddles for the v-th vector: zeta / -zeta at the
+    # positions of the odd coefficient of each pair, 0 elsewhere.
+    for v in range(8):
+        t = []
+        for i in range(8):
+            z = zetas[64 + 8 * v + i]
+            t += [0, z, 0, -z]
+        yield from vec(t)
+
+
+def gen_avx512_ntt_zeta_file(dry_run=False):
+    def gen():
+        yield from gen_header()
+        yield "/*"
+        yield " * Table of zeta values used in the AVX-512 NTTs"
+        yield " * See autogenerate_files.py for details."
+        yield " */"
+        yield ""
+        yield from map(lambda t: str(t) + ",", gen_avx512_ntt_zetas())
+        yield ""
+
+    update_file(
+        "mlkem/native/x86_64/src/x86_64_avx512_zetas.i",
+        "\n".join(gen()),
+        dry_run=dry_run,
+    )
+
+
+def gen_portable_simd_ntt_zetas():
+    """Generate the twiddle table used by the portable SIMD NTT, invNTT and
+    mulcache computation. Vector entries hold 8 int16 values; constants for
+    Montgomery multiplication come in pairs of the twisted constant followed
+    by the constant itself."""
+
+    zetas = list(gen_c_zetas())
+
+    def twist(x):
+        return signed_reduce_u16(x * pow(modulus, -1, 2**16))
+
+    def vec(vals):
+        assert len(vals) == 8
+        yield from map(twist, vals)
+        yield from vals
+
+    def blocks(idxs, repeat):
+        return [zetas[i] for i in idxs for _ in range(repeat)]
+
+    # Layers 1-5 (len 128 .. 8) use broadcasts of zetas[1..31]
+    yield from zetas[0:32]
+    yield from map(twist, zetas[0:32])
+
+    # Forward layers 6-7, for the m-th pair of vectors (see ntt.c)
+    for m in range(16):
+        yield from vec(blocks(range(32 + 2 * m, 34 + 2 * m), 4))
+        yield from vec(blocks(range(64 + 4 * m, 68 + 4 * m), 2))
+
+    # Inverse layers 7-6, for the m-th pair of vectors
+    for m in range(16):
+        yield from vec(blocks(range(127 - 4 * m, 123 - 4 * m, -1), 2))
+        yield from vec(blocks(range(63 - 2 * m, 61 - 2 * m, -1), 4))
+
+    # Mulcache twiddles for the m-th pair of vectors: zeta / -zeta for
+    # the odd coefficient of each pair.
+    for m in range(16):
+        t = []
+        for i in range(4):
+            z = zetas[64 + 4 * m + i]
+            t += [z, -z]
+        yield from vec(t)
+
+
+def gen_portable_simd_ntt_zeta_file(dry_run=False):
+    def gen():
+        yield from gen_header()
+        yield "/*"
+        yield " * Table of zeta values used in the portable SIMD NTTs"
+        yield " * See autogenerate_files.py for details."
+        yield " */"
+        yield ""
+        yield from map(lambda t: str(t) + ",", gen_portable_simd_ntt_zetas())
+        yield ""
+
+    update_file(
+        "mlkem/native/portable_simd/src/portable_simd_zetas.i",
+        "\n".join(gen()),
+        dry_run=dry_run,
+    )
+
+
 def _main():
     parser = argparse.ArgumentParser(
         formatter_class=argparse.ArgumentDefaultsHelpFormatter
@@ -542,6 +669,8 @@ def _main():
     gen_aarch64_rej_uniform_table(args.dry_run)
     gen_avx2_fwd_ntt_zeta_file(args.dry_run)
     gen_avx2_rej_uniform_table(args.dry_run)
+    gen_avx512_ntt_zeta_file(args.dry_run)
+    gen_portable_simd_ntt_zeta_file(args.dry_run)
 
 
 if __name__ == "__main__":
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "cbd.h"
 #include "hal.h"
 #include "kem.h"
 #include "randombytes.h"
@@ -52,6 +53,12 @@ static int cmp_uint64_t(const void *a, const void *b)
   qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t); \
   printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERERATIONS);
 
+/* As BENCH, for code processing len bytes; also reports cycles per byte */
+#define BENCH_BYTES(txt, len, code)                    \
+  BENCH(txt, code)                                     \
+  printf(txt " cycles/byte=%.2f\n",                    \
+         (double)(cyc)[NTESTS >> 1] / NITERERATIONS / (double)(len));
+
 static int bench(void)
 {
   ALIGN uint64_t data0[1024];
@@ -67,12 +74,33 @@ static int bench(void)
 
   BENCH("keccak-f1600-x1", KeccakF1600_StatePermute(data0))
   BENCH("keccak-f1600-x4", KeccakF1600x4_StatePermute(data0))
+#if defined(MLKEM_NATIVE_FIPS202_BACKEND_X86_64_AVX512)
+  BENCH("keccak-f1600-x8", KeccakF1600x8_StatePermute(data0))
+#endif
+
+  /* Single-lane hashing, with the input lengths used in the KEM */
+  /* H(pk) */
+  BENCH_BYTES("sha3_256", MLKEM_PUBLICKEYBYTES,
+              sha3_256((uint8_t *)data0, (uint8_t *)data1,
+                       MLKEM_PUBLICKEYBYTES))
+  /* G(m || H(pk)) */
+  BENCH_BYTES("sha3_512", 2 * MLKEM_SYMBYTES,
+              sha3_512((uint8_t *)data0, (uint8_t *)data1, 2 * MLKEM_SYMBYTES))
+  /* J(z || ct) */
+  BENCH_BYTES("shake256", MLKEM_SYMBYTES + MLKEM_CIPHERTEXTBYTES,
+              shake256((uint8_t *)data0, MLKEM_SSBYTES, (uint8_t *)data1,
+                       MLKEM_SYMBYTES + MLKEM_CIPHERTEXTBYTES))
+
   BENCH("rej_uniform (bulk)",
         rej_uniform((int16_t *)data0, MLKEM_N, 0, (const uint8_t *)data1,
                     3 * SHAKE128_RATE))
   BENCH("rej_uniform (residue)",
         rej_uniform((int16_t *)data0, MLKEM_N / 2, 0, (const uint8_t *)data1,
                     1 * SHAKE128_RATE))
+  /* Follow-up single-block squeeze in gen_matrix, resuming at an offset */
+  BENCH("rej_uniform (tail)",
+        rej_uniform((int16_t *)data0, MLKEM_N, MLKEM_N - 64,
+                    (const uint8_t *)data1, 1 * SHAKE128_RATE))
 
   /* poly */
   /* poly_compress_du */
@@ -82,6 +110,10 @@ static int bench(void)
   BENCH("poly_decompress_du",
         poly_decompress_du((poly *)data0, (uint8_t *)data1))
 
+  /* poly_decompress_du_ntt */
+  BENCH("poly_decompress_du_ntt",
+        poly_decompress_du_ntt((poly *)data0, (uint8_t *)data1))
+
   /* poly_compress_dv */
   BENCH("poly_compress_dv", poly_compress_dv((uint8_t *)data0, (poly *)data1))
 
@@ -89,6 +121,16 @@ static int bench(void)
   BENCH("poly_decompress_dv",
         poly_decompress_dv((poly *)data0, (uint8_t *)data1))
 
+  /* poly_invntt_add_compress_du */
+  BENCH("poly_invntt_add_compress_du",
+        poly_invntt_add_compress_du((uint8_t *)data0, (poly *)data1,
+                                    (poly *)data2))
+
+  /* poly_invntt_add_compress_dv */
+  BENCH("poly_invntt_add_compress_dv",
+        poly_invntt_add_compress_dv((uint8_t *)data0, (poly *)data1,
+                                    (poly *)data2, (poly *)data3))
+
   /* poly_tobytes */
   BENCH("poly_tobytes", poly_tobytes((uint8_t *)data0, (poly *)data1))
 
@@ -101,6 +143,12 @@ static int bench(void)
   /* poly_tomsg */
   BENCH("poly_tomsg", poly_tomsg((uint8_t *)data0, (poly *)data1))
 
+  /* poly_cbd_eta1 */
+  BENCH("poly_cbd_eta1", poly_cbd_eta1((poly *)data0, (uint8_t *)data1))
+
+  /* poly_cbd_eta2 */
+  BENCH("poly_cbd_eta2", poly_cbd_eta2((poly *)data0, (uint8_t *)data1))
+
   /* poly_getnoise_eta1_4x */
   BENCH("poly_getnoise_eta1_4x",
         poly_getnoise_eta1_4x((poly *)data0, (poly *)data1, (poly *)data2,
@@ -147,6 +195,10 @@ static int bench(void)
   BENCH("polyvec_decompress_du",
         polyvec_decompress_du((polyvec *)data0, (uint8_t *)data1))
 
+  /* polyvec_decompress_du_ntt */
+  BENCH("polyvec_decompress_du_ntt",
+        polyvec_decompress_du_ntt((polyvec *)data0, (uint8_t *)data1))
+
   /* polyvec_tobytes */
   BENCH("polyvec_tobytes", polyvec_tobytes((uint8_t *)data0, (polyvec *)data1))
 
@@ -154,6 +206,9 @@ static int bench(void)
   BENCH("polyvec_frombytes",
         polyvec_frombytes((polyvec *)data0, (uint8_t *)data1))
 
+  /* polyvec_modulus_check */
+  BENCH("polyvec_modulus_check", polyvec_modulus_check((uint8_t *)data0))
+
   /* polyvec_ntt */
   BENCH("polyvec_ntt", polyvec_ntt((polyvec *)data0))
 
@@ -166,6 +221,11 @@ static int bench(void)
                                               (polyvec *)data2,
                                               (polyvec_mulcache *)data3))
 
+  /* polyvec_basemul_acc_montgomery */
+  BENCH("polyvec_basemul_acc_montgomery",
+        polyvec_basemul_acc_montgomery((poly *)data0, (polyvec *)data1,
+                                       (polyvec *)data2))
+
   /* polyvec_mulcache_compute */
   BENCH("polyvec_mulcache_compute",
         polyvec_mulcache_compute((polyvec_mulcache *)data0, (polyvec *)data1))
@@ -218,6 +278,80 @@ static int bench(void)
             (int16_t *)data3));
 #endif /* MLKEM_NATIVE_ARITH_BACKEND_AARCH64_OPT */
 
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT) || \
+    defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+  BENCH("poly-compress-d4-avx2",
+        poly_compress_d4_avx2((uint8_t *)data0, (__m256i *)data1));
+  BENCH("poly-decompress-d4-avx2",
+        poly_decompress_d4_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-compress-d5-avx2",
+        poly_compress_d5_avx2((uint8_t *)data0, (__m256i *)data1));
+  BENCH("poly-decompress-d5-avx2",
+        poly_decompress_d5_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-compress-d10-avx2",
+        poly_compress_d10_avx2((uint8_t *)data0, (__m256i *)data1));
+  BENCH("poly-decompress-d10-avx2",
+        poly_decompress_d10_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-compress-d11-avx2",
+        poly_compress_d11_avx2((uint8_t *)data0, (__m256i *)data1));
+  BENCH("poly-decompress-d11-avx2",
+        poly_decompress_d11_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-add-reduce-compress-d4-avx2",
+        poly_add_reduce_compress_d4_avx2((uint8_t *)data0, (__m256i *)data1,
+                                         (__m256i *)data2, (__m256i *)data3));
+  BENCH("poly-add-reduce-compress-d10-avx2",
+        poly_add_reduce_compress_d10_avx2((uint8_t *)data0, (__m256i *)data1,
+                                          (__m256i *)data2));
+  BENCH("poly-frommsg-avx2",
+        poly_frommsg_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-tomsg-avx2",
+        poly_tomsg_avx2((uint8_t *)data0, (__m256i *)data1));
+  BENCH("poly-cbd2-avx2", poly_cbd2_avx2((__m256i *)data0, (uint8_t *)data1));
+  BENCH("poly-cbd3-avx2", poly_cbd3_avx2((__m256i *)data0, (uint8_t *)data1));
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_DEFAULT || \
+          MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512)
+  BENCH("ntt-avx512", ntt_avx512((int16_t *)data0, qdata_avx512));
+  BENCH("intt-avx512", invntt_avx512((int16_t *)data0, qdata_avx512));
+  BENCH("poly-reduce-avx512", reduce_avx512((int16_t *)data0));
+  BENCH("poly-tomont-avx512", tomont_avx512((int16_t *)data0));
+  BENCH("poly-tobytes-avx512",
+        ntttobytes_avx512((uint8_t *)data0, (int16_t *)data1));
+  BENCH("poly-frombytes-avx512",
+        nttfrombytes_avx512((int16_t *)data0, (uint8_t *)data1));
+  BENCH("poly-mulcache-compute-avx512",
+        poly_mulcache_compute_avx512((int16_t *)data0, (int16_t *)data1,
+                                     qdata_avx512));
+  BENCH("poly-basemul-acc-montgomery-avx512",
+        polyvec_basemul_acc_montgomery_cached_avx512(
+            (poly *)data0, (polyvec *)data1, (polyvec *)data2,
+            (polyvec_mulcache *)data3));
+  BENCH("rej-uniform-avx512",
+        rej_uniform_avx512((int16_t *)data0, MLKEM_N, (uint8_t *)data1,
+                           3 * SHAKE128_RATE));
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_X86_64_AVX512 */
+
+#if defined(MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD)
+  BENCH("ntt-portable-simd",
+        ntt_portable_simd((int16_t *)data0, qdata_portable_simd));
+  BENCH("intt-portable-simd",
+        invntt_portable_simd((int16_t *)data0, qdata_portable_simd));
+  BENCH("poly-reduce-portable-simd", reduce_portable_simd((int16_t *)data0));
+  BENCH("poly-tomont-portable-simd", tomont_portable_simd((int16_t *)data0));
+  BENCH("poly-tobytes-portable-simd",
+        ntttobytes_portable_simd((uint8_t *)data0, (int16_t *)data1));
+  BENCH("poly-frombytes-portable-simd",
+        nttfrombytes_portable_simd((int16_t *)data0, (uint8_t *)data1));
+  BENCH("poly-mulcache-compute-portable-simd",
+        poly_mulcache_compute_portable_simd((int16_t *)data0, (int16_t *)data1,
+                                            qdata_portable_simd));
+  BENCH("poly-basemul-acc-montgomery-portable-simd",
+        polyvec_basemul_acc_montgomery_cached_portable_simd(
+            (poly *)data0, (polyvec *)data1, (polyvec *)data2,
+            (polyvec_mulcache *)data3));
+#endif /* MLKEM_NATIVE_ARITH_BACKEND_PORTABLE_SIMD */
+
   return 0;
 }
 
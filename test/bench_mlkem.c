@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "dispatch.h"
 #include "hal.h"
 #include "kem.h"
 #include "randombytes.h"
@@ -54,10 +55,38 @@ static int bench(void)
   uint8_t key_b[CRYPTO_BYTES];
   unsigned char kg_rand[2 * CRYPTO_BYTES], enc_rand[CRYPTO_BYTES];
   uint64_t cycles_kg[NTESTS], cycles_enc[NTESTS], cycles_dec[NTESTS];
+  uint64_t cycles_enc_exp[NTESTS], cycles_dec_exp[NTESTS];
+  uint64_t cycles_enc_cache[NTESTS];
+  mlkem_expanded_pk epk;
+  mlkem_pk_cache_entry cache_entries[1];
+  mlkem_pk_cache cache;
+  mlkem_expanded_sk esk;
+  uint8_t ct_x4[4][CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_x4[4][CRYPTO_BYTES];
+  uint8_t *ct_x4_ptr[4], *key_x4_ptr[4];
+  const uint8_t *pk_x4_ptr[4], *enc_rand_x4_ptr[4];
+  const uint8_t *ct_x4_cptr[4], *sk_x4_ptr[4];
+  uint8_t pk_x4[4][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk_x4[4][CRYPTO_SECRETKEYBYTES];
+  uint8_t *pk_x4_out[4], *sk_x4_out[4];
+  const uint8_t *kg_rand_x4_ptr[4];
+  uint64_t cycles_kg_x4[NTESTS], cycles_enc_x4[NTESTS], cycles_dec_x4[NTESTS];
 
   unsigned int i, j;
   uint64_t t0, t1;
 
+  for (j = 0; j < 4; j++)
+  {
+    ct_x4_ptr[j] = ct_x4[j];
+    key_x4_ptr[j] = key_x4[j];
+    pk_x4_ptr[j] = pk;
+    enc_rand_x4_ptr[j] = enc_rand;
+    ct_x4_cptr[j] = ct_x4[j];
+    sk_x4_ptr[j] = sk;
+    pk_x4_out[j] = pk_x4[j];
+    sk_x4_out[j] = sk_x4[j];
+    kg_rand_x4_ptr[j] = kg_rand;
+  }
 
   for (i = 0; i < NTESTS; i++)
   {
@@ -78,6 +107,19 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_kg[i] = t1 - t0;
 
+    /* Batched key-pair generation (cycles per batch of 4) */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_keypair_batch(4, pk_x4_out, sk_x4_out, kg_rand_x4_ptr);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_keypair_batch(4, pk_x4_out, sk_x4_out, kg_rand_x4_ptr);
+    }
+    t1 = get_cyclecounter();
+    cycles_kg_x4[i] = t1 - t0;
+
 
     /* Encapsulation */
     for (j = 0; j < NWARMUP; j++)
@@ -92,6 +134,49 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_enc[i] = t1 - t0;
 
+    /* Encapsulation against pre-expanded public key */
+    crypto_kem_pk_expand(&epk, pk);
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_enc_expanded_derand(ct, key_a, &epk, enc_rand);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_enc_expanded_derand(ct, key_a, &epk, enc_rand);
+    }
+    t1 = get_cyclecounter();
+    cycles_enc_exp[i] = t1 - t0;
+
+    /* Encapsulation via public key cache (hits after the first call) */
+    crypto_kem_pk_cache_init(&cache, cache_entries, 1, NULL, NULL, NULL);
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_enc_cached_derand(ct, key_a, pk, &cache, enc_rand);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_enc_cached_derand(ct, key_a, pk, &cache, enc_rand);
+    }
+    t1 = get_cyclecounter();
+    cycles_enc_cache[i] = t1 - t0;
+
+    /* Four-way batched encapsulation (cycles per batch of 4) */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_enc_x4_derand(ct_x4_ptr, key_x4_ptr, pk_x4_ptr,
+                               enc_rand_x4_ptr);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_enc_x4_derand(ct_x4_ptr, key_x4_ptr, pk_x4_ptr,
+                               enc_rand_x4_ptr);
+    }
+    t1 = get_cyclecounter();
+    cycles_enc_x4[i] = t1 - t0;
+
     /* Decapsulation */
     for (j = 0; j < NWARMUP; j++)
     {
@@ -106,7 +191,35 @@ static int bench(void)
     cycles_dec[i] = t1 - t0;
 
 
-    if (memcmp(key_a, key_b, CRYPTO_BYTES))
+    /* Decapsulation against pre-expanded secret key */
+    crypto_kem_sk_expand(&esk, sk);
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_dec_expanded(key_b, ct, &esk);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_dec_expanded(key_b, ct, &esk);
+    }
+    t1 = get_cyclecounter();
+    cycles_dec_exp[i] = t1 - t0;
+
+    /* Four-way batched decapsulation (cycles per batch of 4) */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      crypto_kem_dec_x4(key_x4_ptr, ct_x4_cptr, sk_x4_ptr);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_dec_x4(key_x4_ptr, ct_x4_cptr, sk_x4_ptr);
+    }
+    t1 = get_cyclecounter();
+    cycles_dec_x4[i] = t1 - t0;
+
+    if (memcmp(key_a, key_b, CRYPTO_BYTES) ||
+        memcmp(key_a, key_x4[0], CRYPTO_BYTES))
     {
       printf("ERROR keys\n");
       return 1;
@@ -114,28 +227,106 @@ static int bench(void)
   }
 
   qsort(cycles_kg, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_kg_x4, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_enc, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_enc_exp, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_enc_cache, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_enc_x4, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_dec, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_dec_exp, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_dec_x4, NTESTS, sizeof(uint64_t), cmp_uint64_t);
 
   print_median("keypair", cycles_kg);
+  print_median("keypair_x4", cycles_kg_x4);
   print_median("encaps", cycles_enc);
+  print_median("encaps_exp", cycles_enc_exp);
+  print_median("encaps_pkc", cycles_enc_cache);
+  print_median("encaps_x4", cycles_enc_x4);
   print_median("decaps", cycles_dec);
+  print_median("decaps_exp", cycles_dec_exp);
+  print_median("decaps_x4", cycles_dec_x4);
 
   printf("\n");
 
   print_percentile_legend();
 
   print_percentiles("keypair", cycles_kg);
+  print_percentiles("keypair_x4", cycles_kg_x4);
   print_percentiles("encaps", cycles_enc);
+  print_percentiles("encaps_exp", cycles_enc_exp);
+  print_percentiles("encaps_pkc", cycles_enc_cache);
+  print_percentiles("encaps_x4", cycles_enc_x4);
   print_percentiles("decaps", cycles_dec);
+  print_percentiles("decaps_exp", cycles_dec_exp);
+  print_percentiles("decaps_x4", cycles_dec_x4);
+
+  return 0;
+}
+
+#if defined(MLKEM_NATIVE_DISPATCH)
+/*
+ * Cost of runtime dispatch: backend selection via CPUID, and the call
+ * overhead of the public API, measured on an empty batch (n = 0) through
+ * the dispatching wrapper and directly through the backend's table.
+ */
+static int bench_dispatch(void)
+{
+  const mlkem_backend *backend = mlkem_backend_get();
+  uint64_t cycles_select[NTESTS], cycles_wrap[NTESTS], cycles_direct[NTESTS];
+  unsigned int i, j;
+  uint64_t t0, t1;
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      if (mlkem_backend_select() != backend)
+      {
+        printf("ERROR backend selection\n");
+        return 1;
+      }
+    }
+    t1 = get_cyclecounter();
+    cycles_select[i] = t1 - t0;
+
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      crypto_kem_keypair_batch(0, NULL, NULL, NULL);
+    }
+    t1 = get_cyclecounter();
+    cycles_wrap[i] = t1 - t0;
+
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      backend->keypair_batch(0, NULL, NULL, NULL);
+    }
+    t1 = get_cyclecounter();
+    cycles_direct[i] = t1 - t0;
+  }
+
+  qsort(cycles_select, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_wrap, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_direct, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+
+  printf("\nbackend: %s\n", backend->name);
+  print_median("select", cycles_select);
+  print_median("call_disp", cycles_wrap);
+  print_median("call_dir", cycles_direct);
 
   return 0;
 }
+#endif /* MLKEM_NATIVE_DISPATCH */
 
 int main(void)
 {
   enable_cyclecounter();
   bench();
+#if defined(MLKEM_NATIVE_DISPATCH)
+  bench_dispatch();
+#endif
   disable_cyclecounter();
 
   return 0;
@@ -69,6 +69,515 @@ static int test_invalid_pk(void)
   return 0;
 }
 
+/* Set the i-th 12-bit coefficient of the packed vector in pk to c */
+static void pk_set_coeff(uint8_t *pk, unsigned int i, uint16_t c)
+{
+  uint8_t *p = pk + 3 * (i / 2);
+  if (i % 2 == 0)
+  {
+    p[0] = (uint8_t)c;
+    p[1] = (uint8_t)((p[1] & 0xF0) | (c >> 8));
+  }
+  else
+  {
+    p[1] = (uint8_t)((p[1] & 0x0F) | ((c & 0x0F) << 4));
+    p[2] = (uint8_t)(c >> 4);
+  }
+}
+
+/*
+ * Check the modulus check on the boundary: q - 1 must be accepted and q
+ * rejected, at even and odd coefficients, which are packed differently,
+ * and in the first and the last polynomial of the public key.
+ */
+static int test_pk_modulus_boundary(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ct[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_b[CRYPTO_BYTES];
+  const unsigned int pos[] = {0,
+                              1,
+                              MLKEM_N - 2,
+                              MLKEM_N - 1,
+                              (MLKEM_K - 1) * MLKEM_N,
+                              (MLKEM_K - 1) * MLKEM_N + 1,
+                              MLKEM_K * MLKEM_N - 2,
+                              MLKEM_K * MLKEM_N - 1};
+  unsigned int j;
+
+  crypto_kem_keypair(pk, sk);
+
+  for (j = 0; j < sizeof(pos) / sizeof(pos[0]); j++)
+  {
+    pk_set_coeff(pk, pos[j], MLKEM_Q - 1);
+    if (crypto_kem_enc(ct, key_b, pk))
+    {
+      printf("ERROR test_pk_modulus_boundary: q-1 rejected at %u\n", pos[j]);
+      return 1;
+    }
+
+    pk_set_coeff(pk, pos[j], MLKEM_Q);
+    if (!crypto_kem_enc(ct, key_b, pk))
+    {
+      printf("ERROR test_pk_modulus_boundary: q accepted at %u\n", pos[j]);
+      return 1;
+    }
+
+    pk_set_coeff(pk, pos[j], 0);
+  }
+
+  return 0;
+}
+
+static int test_expanded_pk(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ct_a[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t ct_b[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[CRYPTO_BYTES];
+  uint8_t key_b[CRYPTO_BYTES];
+  uint8_t key_c[CRYPTO_BYTES];
+  uint8_t coins[CRYPTO_BYTES];
+  mlkem_expanded_pk epk;
+  int rc;
+
+  /* Alice generates a public key */
+  crypto_kem_keypair(pk, sk);
+
+  /* Bob expands it once, and encapsulates against the expanded key */
+  rc = crypto_kem_pk_expand(&epk, pk);
+  if (rc)
+  {
+    printf("ERROR test_expanded_pk\n");
+    return 1;
+  }
+
+  /* Expanded and non-expanded encapsulation must agree */
+  randombytes(coins, CRYPTO_BYTES);
+  crypto_kem_enc_derand(ct_a, key_a, pk, coins);
+  crypto_kem_enc_expanded_derand(ct_b, key_b, &epk, coins);
+  if (memcmp(ct_a, ct_b, CRYPTO_CIPHERTEXTBYTES) ||
+      memcmp(key_a, key_b, CRYPTO_BYTES))
+  {
+    printf("ERROR test_expanded_pk\n");
+    return 1;
+  }
+
+  crypto_kem_enc_expanded(ct_b, key_b, &epk);
+  crypto_kem_dec(key_c, ct_b, sk);
+  if (memcmp(key_b, key_c, CRYPTO_BYTES))
+  {
+    printf("ERROR test_expanded_pk\n");
+    return 1;
+  }
+
+  /* set first public key coefficient to 4095 (0xFFF) */
+  pk[0] = 0xFF;
+  pk[1] |= 0x0F;
+  rc = crypto_kem_pk_expand(&epk, pk);
+  if (!rc)
+  {
+    printf("ERROR test_expanded_pk\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_expanded_sk(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ct[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[CRYPTO_BYTES];
+  uint8_t key_b[CRYPTO_BYTES];
+  uint8_t key_c[CRYPTO_BYTES];
+  mlkem_expanded_sk esk;
+  int rc;
+
+  /* Alice generates a key pair and expands her secret key */
+  crypto_kem_keypair(pk, sk);
+  rc = crypto_kem_sk_expand(&esk, sk);
+  if (rc)
+  {
+    printf("ERROR test_expanded_sk\n");
+    return 1;
+  }
+
+  /* Bob derives a secret key and creates a response */
+  crypto_kem_enc(ct, key_b, pk);
+
+  /* Alice uses Bobs response to get her shared key */
+  crypto_kem_dec_expanded(key_a, ct, &esk);
+  if (memcmp(key_a, key_b, CRYPTO_BYTES))
+  {
+    printf("ERROR test_expanded_sk\n");
+    return 1;
+  }
+
+  /* Implicit rejection must match the non-expanded decapsulation */
+  ct[0] ^= 1;
+  crypto_kem_dec_expanded(key_a, ct, &esk);
+  crypto_kem_dec(key_c, ct, sk);
+  if (!memcmp(key_a, key_b, CRYPTO_BYTES) ||
+      memcmp(key_a, key_c, CRYPTO_BYTES))
+  {
+    printf("ERROR test_expanded_sk\n");
+    return 1;
+  }
+
+  /* Replace H(pk) with radom values; expansion must fail */
+  randombytes(sk + CRYPTO_SECRETKEYBYTES - 64, 32);
+  rc = crypto_kem_sk_expand(&esk, sk);
+  if (!rc)
+  {
+    printf("ERROR test_expanded_sk\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_workspace(void)
+{
+  uint8_t pk_a[CRYPTO_PUBLICKEYBYTES], pk_b[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk_a[CRYPTO_SECRETKEYBYTES], sk_b[CRYPTO_SECRETKEYBYTES];
+  uint8_t ct_a[CRYPTO_CIPHERTEXTBYTES], ct_b[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[CRYPTO_BYTES], key_b[CRYPTO_BYTES], key_c[CRYPTO_BYTES];
+  uint8_t coins[2 * CRYPTO_BYTES];
+  /* Reused across all calls, as a caller pooling workspaces would */
+  static mlkem_workspace ws;
+
+  /* Workspace and stack variants must agree */
+  randombytes(coins, 2 * CRYPTO_BYTES);
+  crypto_kem_keypair_derand(pk_a, sk_a, coins);
+  crypto_kem_keypair_derand_ws(pk_b, sk_b, coins, &ws);
+  if (memcmp(pk_a, pk_b, CRYPTO_PUBLICKEYBYTES) ||
+      memcmp(sk_a, sk_b, CRYPTO_SECRETKEYBYTES))
+  {
+    printf("ERROR test_workspace\n");
+    return 1;
+  }
+
+  randombytes(coins, CRYPTO_BYTES);
+  crypto_kem_enc_derand(ct_a, key_a, pk_a, coins);
+  crypto_kem_enc_derand_ws(ct_b, key_b, pk_a, coins, &ws);
+  if (memcmp(ct_a, ct_b, CRYPTO_CIPHERTEXTBYTES) ||
+      memcmp(key_a, key_b, CRYPTO_BYTES))
+  {
+    printf("ERROR test_workspace\n");
+    return 1;
+  }
+
+  crypto_kem_dec_ws(key_c, ct_a, sk_a, &ws);
+  if (memcmp(key_a, key_c, CRYPTO_BYTES))
+  {
+    printf("ERROR test_workspace\n");
+    return 1;
+  }
+
+  crypto_kem_keypair_ws(pk_a, sk_a, &ws);
+  if (crypto_kem_enc_ws(ct_a, key_a, pk_a, &ws) ||
+      crypto_kem_dec_ws(key_b, ct_a, sk_a, &ws) ||
+      memcmp(key_a, key_b, CRYPTO_BYTES))
+  {
+    printf("ERROR test_workspace\n");
+    return 1;
+  }
+
+  /* Failing checks behave as without workspace */
+  pk_a[0] = 0xFF;
+  pk_a[1] |= 0x0F;
+  sk_a[CRYPTO_SECRETKEYBYTES - 2 * CRYPTO_BYTES] ^= 1;
+  if (!crypto_kem_enc_ws(ct_a, key_a, pk_a, &ws) ||
+      !crypto_kem_dec_ws(key_b, ct_a, sk_a, &ws))
+  {
+    printf("ERROR test_workspace\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+/* Stand-in for a mutex, checking that lock and unlock calls pair up */
+static void pk_cache_test_lock(void *arg) { (*(int *)arg)++; }
+static void pk_cache_test_unlock(void *arg) { (*(int *)arg)--; }
+
+static int test_pk_cache(void)
+{
+  uint8_t pk[3][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[3][CRYPTO_SECRETKEYBYTES];
+  uint8_t ct_a[CRYPTO_CIPHERTEXTBYTES], ct_b[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[CRYPTO_BYTES], key_b[CRYPTO_BYTES];
+  uint8_t coins[CRYPTO_BYTES];
+  static mlkem_pk_cache_entry entries[2];
+  mlkem_pk_cache cache;
+  uint64_t hits, misses;
+  int locked = 0, i;
+  /* Public key used by each call, and whether it is a hit */
+  const int order[6] = {0, 0, 1, 2, 0, 2};
+  const int hit[6] = {0, 1, 0, 0, 0, 1};
+
+  if (crypto_kem_pk_cache_init(&cache, entries, 0, NULL, NULL, NULL) == 0 ||
+      crypto_kem_pk_cache_init(&cache, entries, 2, pk_cache_test_lock, NULL,
+                               &locked) == 0 ||
+      crypto_kem_pk_cache_init(&cache, entries, 2, pk_cache_test_lock,
+                               pk_cache_test_unlock, &locked) != 0)
+  {
+    printf("ERROR test_pk_cache init\n");
+    return 1;
+  }
+
+  for (i = 0; i < 3; i++)
+  {
+    crypto_kem_keypair(pk[i], sk[i]);
+  }
+
+  /* With room for two keys, the third one evicts the least recently used */
+  for (i = 0; i < 6; i++)
+  {
+    const int k = order[i];
+    uint64_t expected_hits = 0;
+    int j;
+    for (j = 0; j <= i; j++)
+    {
+      expected_hits += (uint64_t)hit[j];
+    }
+
+    randombytes(coins, CRYPTO_BYTES);
+    crypto_kem_enc_derand(ct_a, key_a, pk[k], coins);
+    if (crypto_kem_enc_cached_derand(ct_b, key_b, pk[k], &cache, coins) ||
+        memcmp(ct_a, ct_b, CRYPTO_CIPHERTEXTBYTES) ||
+        memcmp(key_a, key_b, CRYPTO_BYTES))
+    {
+      printf("ERROR test_pk_cache enc\n");
+      return 1;
+    }
+
+    crypto_kem_pk_cache_stats(&cache, &hits, &misses);
+    if (hits != expected_hits || misses != (uint64_t)(i + 1) - expected_hits ||
+        locked != 0)
+    {
+      printf("ERROR test_pk_cache stats\n");
+      return 1;
+    }
+  }
+
+  if (crypto_kem_enc_cached(ct_a, key_a, pk[2], &cache) ||
+      crypto_kem_dec(key_b, ct_a, sk[2]) || memcmp(key_a, key_b, CRYPTO_BYTES))
+  {
+    printf("ERROR test_pk_cache dec\n");
+    return 1;
+  }
+
+  /* Invalid keys are rejected and not cached */
+  pk[1][0] = 0xFF;
+  pk[1][1] |= 0x0F;
+  for (i = 0; i < 2; i++)
+  {
+    if (!crypto_kem_enc_cached(ct_a, key_a, pk[1], &cache))
+    {
+      printf("ERROR test_pk_cache invalid pk\n");
+      return 1;
+    }
+  }
+  crypto_kem_pk_cache_stats(&cache, &hits, &misses);
+  if (hits != 3 || misses != 6 || locked != 0)
+  {
+    printf("ERROR test_pk_cache invalid pk stats\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_enc_x4(void)
+{
+  uint8_t pk[4][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[4][CRYPTO_SECRETKEYBYTES];
+  uint8_t ct[4][CRYPTO_CIPHERTEXTBYTES];
+  uint8_t ct_ref[CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[4][CRYPTO_BYTES];
+  uint8_t key_b[CRYPTO_BYTES];
+  uint8_t coins[4][CRYPTO_BYTES];
+  uint8_t *ct_ptr[4], *key_ptr[4];
+  const uint8_t *pk_ptr[4], *coins_ptr[4];
+  unsigned int i;
+  int rc;
+
+  /* Alice generates two public keys, one of which is used twice */
+  for (i = 0; i < 4; i++)
+  {
+    if (i != 3)
+    {
+      crypto_kem_keypair(pk[i], sk[i]);
+    }
+    ct_ptr[i] = ct[i];
+    key_ptr[i] = key_a[i];
+    pk_ptr[i] = pk[i];
+    coins_ptr[i] = coins[i];
+  }
+  pk_ptr[3] = pk[0];
+
+  /* Bob encapsulates to all of them at once */
+  randombytes(coins[0], sizeof(coins));
+  rc = crypto_kem_enc_x4_derand(ct_ptr, key_ptr, pk_ptr, coins_ptr);
+  if (rc)
+  {
+    printf("ERROR test_enc_x4\n");
+    return 1;
+  }
+
+  /* Batched and sequential encapsulation must agree */
+  for (i = 0; i < 4; i++)
+  {
+    crypto_kem_enc_derand(ct_ref, key_b, pk_ptr[i], coins[i]);
+    if (memcmp(ct[i], ct_ref, CRYPTO_CIPHERTEXTBYTES) ||
+        memcmp(key_a[i], key_b, CRYPTO_BYTES))
+    {
+      printf("ERROR test_enc_x4\n");
+      return 1;
+    }
+  }
+
+  crypto_kem_enc_x4(ct_ptr, key_ptr, pk_ptr);
+  for (i = 0; i < 4; i++)
+  {
+    crypto_kem_dec(key_b, ct[i], sk[i == 3 ? 0 : i]);
+    if (memcmp(key_a[i], key_b, CRYPTO_BYTES))
+    {
+      printf("ERROR test_enc_x4\n");
+      return 1;
+    }
+  }
+
+  /* set first coefficient of one public key to 4095 (0xFFF) */
+  pk[2][0] = 0xFF;
+  pk[2][1] |= 0x0F;
+  rc = crypto_kem_enc_x4(ct_ptr, key_ptr, pk_ptr);
+  if (!rc)
+  {
+    printf("ERROR test_enc_x4\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+#define KEYPAIR_BATCH 9
+static int test_keypair_batch(void)
+{
+  uint8_t pk[KEYPAIR_BATCH][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[KEYPAIR_BATCH][CRYPTO_SECRETKEYBYTES];
+  uint8_t pk_ref[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk_ref[CRYPTO_SECRETKEYBYTES];
+  uint8_t coins[KEYPAIR_BATCH][2 * CRYPTO_BYTES];
+  uint8_t *pk_ptr[KEYPAIR_BATCH], *sk_ptr[KEYPAIR_BATCH];
+  const uint8_t *coins_ptr[KEYPAIR_BATCH];
+  unsigned int i, n;
+
+  randombytes(coins[0], sizeof(coins));
+  for (i = 0; i < KEYPAIR_BATCH; i++)
+  {
+    pk_ptr[i] = pk[i];
+    sk_ptr[i] = sk[i];
+    coins_ptr[i] = coins[i];
+  }
+
+  /* Cover full groups and every size of a partial last group */
+  for (n = 1; n <= KEYPAIR_BATCH; n++)
+  {
+    memset(pk, 0, sizeof(pk));
+    memset(sk, 0, sizeof(sk));
+    crypto_kem_keypair_batch(n, pk_ptr, sk_ptr, coins_ptr);
+
+    /* Batched and sequential key generation must agree */
+    for (i = 0; i < n; i++)
+    {
+      crypto_kem_keypair_derand(pk_ref, sk_ref, coins[i]);
+      if (memcmp(pk[i], pk_ref, CRYPTO_PUBLICKEYBYTES) ||
+          memcmp(sk[i], sk_ref, CRYPTO_SECRETKEYBYTES))
+      {
+        printf("ERROR test_keypair_batch (n = %u)\n", n);
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+#define DEC_BATCH 7
+static int test_dec_batch(void)
+{
+  uint8_t pk[2][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[2][CRYPTO_SECRETKEYBYTES];
+  uint8_t sk_invalid[CRYPTO_SECRETKEYBYTES];
+  uint8_t ct[DEC_BATCH][CRYPTO_CIPHERTEXTBYTES];
+  uint8_t key_a[DEC_BATCH][CRYPTO_BYTES];
+  uint8_t key_b[DEC_BATCH][CRYPTO_BYTES];
+  uint8_t *key_ptr[DEC_BATCH];
+  const uint8_t *ct_ptr[DEC_BATCH], *sk_ptr[DEC_BATCH];
+  unsigned int i;
+  int rc;
+
+  /* Alice generates two key pairs */
+  crypto_kem_keypair(pk[0], sk[0]);
+  crypto_kem_keypair(pk[1], sk[1]);
+
+  /* Bob creates responses to both, corrupting every third of them */
+  for (i = 0; i < DEC_BATCH; i++)
+  {
+    crypto_kem_enc(ct[i], key_b[i], pk[i % 2]);
+    if (i % 3 == 2)
+    {
+      ct[i][i] ^= 1;
+    }
+    key_ptr[i] = key_a[i];
+    ct_ptr[i] = ct[i];
+    sk_ptr[i] = sk[i % 2];
+  }
+
+  /* Alice decapsulates all of them together */
+  rc = crypto_kem_dec_batch(DEC_BATCH, key_ptr, ct_ptr, sk_ptr);
+  if (rc)
+  {
+    printf("ERROR test_dec_batch\n");
+    return 1;
+  }
+
+  for (i = 0; i < DEC_BATCH; i++)
+  {
+    /* Valid responses must match, invalid ones must match crypto_kem_dec */
+    if (i % 3 == 2)
+    {
+      crypto_kem_dec(key_b[i], ct[i], sk[i % 2]);
+    }
+    if (memcmp(key_a[i], key_b[i], CRYPTO_BYTES))
+    {
+      printf("ERROR test_dec_batch\n");
+      return 1;
+    }
+  }
+
+  /* An invalid secret key fails its entry, but not the others */
+  memcpy(sk_invalid, sk[1], CRYPTO_SECRETKEYBYTES);
+  sk_invalid[CRYPTO_SECRETKEYBYTES - 64] ^= 1;
+  sk_ptr[1] = sk_invalid;
+  memset(key_a, 0, sizeof(key_a));
+  rc = crypto_kem_dec_batch(DEC_BATCH, key_ptr, ct_ptr, sk_ptr);
+  if (!rc || memcmp(key_a[0], key_b[0], CRYPTO_BYTES) ||
+      memcmp(key_a[DEC_BATCH - 1], key_b[DEC_BATCH - 1], CRYPTO_BYTES))
+  {
+    printf("ERROR test_dec_batch\n");
+    return 1;
+  }
+
+  return 0;
+}
+
 static int test_invalid_sk_a(void)
 {
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
@@ -185,6 +694,14 @@ int main(void)
   {
     r = test_keys();
     r |= test_invalid_pk();
+    r |= test_pk_modulus_boundary();
+    r |= test_expanded_pk();
+    r |= test_expanded_sk();
+    r |= test_workspace();
+    r |= test_pk_cache();
+    r |= test_enc_x4();
+    r |= test_dec_batch();
+    r |= test_keypair_batch();
     r |= test_invalid_sk_a();
     r |= test_invalid_sk_b();
     r |= test_invalid_ciphertext();